@@ -0,0 +1,225 @@
+
+//============================================================================================//
+/*
+  Replays synthetic jitter traces through the touch filter of CSE_UI and counts the button
+  events they cause.
+
+  Each trace is run twice: once with the raw samples, and once with the median filter,
+  debounce and hysteresis on. With the filter on, every trace must give exactly the
+  touches, presses and cancels a person would expect. The raw runs are printed for
+  comparison only.
+
+  The widgets are polled without beginFrame(), as older sketches do, with three widgets
+  asking for the touch state in every pass. The test also checks that the panel (the
+  replay here) is read once per pass, not once per widget.
+*/
+//============================================================================================//
+
+#include <Arduino.h>  // Standard libraries
+#include <SPI.h>
+
+#include <TFT_eSPI.h> // TFT LCD library
+#include <CSE_UI.h>
+
+#include "traces.h"
+
+//============================================================================================//
+
+#define  LCD_ROTATION       3   // The LCD panel rotation
+
+//============================================================================================//
+// Globals
+
+TFT_eSPI LCD = TFT_eSPI(); // Create a new TFT driver instance
+
+// UI objects. There is no touch panel; the replay stands in for it.
+CSE_UI myui (&LCD, NULL);
+touchReplayClass replay;
+
+buttonClass testButton (&myui); // The button the traces touch
+buttonClass otherButton (&myui);  // Polled but never touched
+buttonClass thirdButton (&myui);
+
+struct traceTest {
+  const char* name;
+  const uint8_t* data;
+  uint32_t length;
+  uint16_t records;
+  uint16_t touches; // Expected with the filter on
+  uint16_t presses;
+  uint16_t cancels;
+};
+
+const traceTest traceTests [] = {
+  {"edge", traceEdge, sizeof (traceEdge), 135, 1, 1, 0},
+  {"tap", traceTap, sizeof (traceTap), 46, 1, 1, 0},
+  {"drag", traceDrag, sizeof (traceDrag), 101, 1, 0, 1}
+};
+
+uint16_t touchEvents = 0;
+uint16_t pressEvents = 0;
+uint16_t cancelEvents = 0;
+
+bool testDone = false;
+
+//============================================================================================//
+// Forward Declarations
+
+void setup (void);
+void loop (void);
+
+bool initLCD (void);
+void setFilter (bool filtered);
+bool runTrace (const traceTest& test, bool filtered);
+void onEvent (const CSE_UI_Event& event);
+
+//============================================================================================//
+/**
+ * @brief Setup runs once.
+ *
+ */
+void setup() {
+  Serial.begin (115200);
+  delay (2000);
+
+  Serial.println();
+  Serial.println (F("=== CSE_UI - Filter Trace Test ==="));
+
+  initLCD();
+
+  testButton.initialize (40, 100, 160, 60, TFT_RED, TFT_WHITE, "Test");
+  otherButton.initialize (40, 10, 70, 60, TFT_RED, TFT_WHITE, "A");
+  thirdButton.initialize (130, 10, 70, 60, TFT_RED, TFT_WHITE, "B");
+
+  myui.setTouchReplay (&replay);
+  myui.setEventHandler (onEvent);
+}
+
+//============================================================================================//
+/**
+ * @brief Infinite loop. Runs every trace once, then idles.
+ *
+ */
+void loop() {
+  if (testDone) {
+    delay (1000);
+    return;
+  }
+
+  bool pass = true;
+
+  for (uint8_t i = 0; i < (sizeof (traceTests) / sizeof (traceTests [0])); i++) {
+    runTrace (traceTests [i], false);
+    pass = runTrace (traceTests [i], true) && pass;
+  }
+
+  Serial.println();
+  Serial.println (pass ? F("loop [INFO]: PASS") : F("loop [ERROR]: FAIL"));
+  testDone = true;
+}
+
+//============================================================================================//
+/**
+ * @brief Initialize the LCD.
+ *
+ * @return true
+ * @return false
+ */
+bool initLCD() {
+  LCD.begin();
+  LCD.setRotation (LCD_ROTATION);
+  LCD.fillScreen (TFT_BLACK);
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Sets up the touch filter. Both settings reset the state of the filter.
+ *
+ * @param filtered true for median smoothing, debounce and hysteresis; false for raw.
+ */
+void setFilter (bool filtered) {
+  if (filtered) {
+    myui.touchFilter.setSmoothing (CSEUI_FILTER_MEDIAN);
+    myui.touchFilter.setDebounce (2, 3);
+    myui.touchFilter.setHysteresis (6);
+  }
+  else {
+    myui.touchFilter.setSmoothing (CSEUI_FILTER_NONE);
+    myui.touchFilter.setDebounce (1, 1);
+    myui.touchFilter.setHysteresis (0);
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Replays one trace, one record per pass, and prints the events it caused.
+ *
+ * @param test The trace and the expected counts.
+ * @param filtered Run with the filter on, and check the counts.
+ * @return true The counts are as expected, or the run is not checked.
+ * @return false The counts are wrong, or the trace was read more than once per pass.
+ */
+bool runTrace (const traceTest& test, bool filtered) {
+  setFilter (filtered);
+  replay.begin (test.data, test.length, false); // One record per read
+
+  touchEvents = 0;
+  pressEvents = 0;
+  cancelEvents = 0;
+
+  uint16_t passes = 0;
+
+  while (!replay.isFinished()) {
+    testButton.isTouched();
+    otherButton.isTouched();
+    thirdButton.isTouched();
+    myui.dispatchEvents();
+    passes++;
+    delay ((CSEUI_TOUCH_SAMPLE_PERIOD / 1000) + 1); // Let the next sample be read
+  }
+
+  Serial.print (F("runTrace [INFO]: "));
+  Serial.print (test.name);
+  Serial.print (filtered ? F(", filtered") : F(", raw"));
+  Serial.print (F(": touches = "));
+  Serial.print (touchEvents);
+  Serial.print (F(", presses = "));
+  Serial.print (pressEvents);
+  Serial.print (F(", cancels = "));
+  Serial.print (cancelEvents);
+  Serial.print (F(", passes = "));
+  Serial.print (passes);
+  Serial.print (F("/"));
+  Serial.println (test.records);
+
+  if (passes != test.records) {
+    Serial.println (F("runTrace [ERROR]: The panel was read more than once per pass."));
+    return false;
+  }
+
+  if (!filtered) return true;
+
+  if ((touchEvents != test.touches) || (pressEvents != test.presses) || (cancelEvents != test.cancels)) {
+    Serial.println (F("runTrace [ERROR]: Unexpected events with the filter on."));
+    return false;
+  }
+
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Counts the events of the test button.
+ *
+ * @param event
+ */
+void onEvent (const CSE_UI_Event& event) {
+  if (event.widget != &testButton) return;
+
+  if (event.type == CSEUI_EVENT_TOUCH) touchEvents++;
+  if (event.type == CSEUI_EVENT_PRESS) pressEvents++;
+  if (event.type == CSEUI_EVENT_CANCEL) cancelEvents++;
+}
+
+//============================================================================================//
@@ -0,0 +1,174 @@
+//============================================================================================//
+/*
+  Synthetic touch traces for the FilterTrace example, generated by tools/filtertraces.py.
+  Each trace is in the format written by touchRecorderClass, with one record for every
+  5 ms sample. The point is on a 160 x 60 button at (40, 100).
+
+  traceEdge:  A finger resting on the left edge of the button, with +/-3 px of jitter,
+              a bounce at touch-down, and four single-sample dropouts.
+  traceTap:   A tap in the middle of the button, with a bounce at touch-down and lift.
+  traceDrag:  A finger that lands in the middle of the button and slowly drags off its
+              right edge before lifting.
+*/
+//============================================================================================//
+
+#ifndef FILTER_TRACES_H
+#define FILTER_TRACES_H
+
+const uint8_t traceEdge [] = {  // 135 records
+  0x43, 0x53, 0x54, 0x54, 0x01, 0x05, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88,
+  0x27, 0x01, 0x00, 0x29, 0x00, 0x80, 0x00, 0x1E, 0x88, 0x27, 0x00, 0x88, 0x27, 0x01, 0x00, 0x27,
+  0x00, 0x82, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00, 0x84, 0x00, 0x1D, 0x88, 0x27, 0x01,
+  0x00, 0x25, 0x00, 0x84, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x28, 0x00, 0x83, 0x00, 0x19, 0x88,
+  0x27, 0x01, 0x00, 0x25, 0x00, 0x80, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00, 0x2A, 0x00, 0x81, 0x00,
+  0x1E, 0x88, 0x27, 0x01, 0x00, 0x25, 0x00, 0x83, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00,
+  0x84, 0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x81, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00,
+  0x26, 0x00, 0x81, 0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x83, 0x00, 0x23, 0x88, 0x27,
+  0x01, 0x00, 0x2B, 0x00, 0x84, 0x00, 0x21, 0x88, 0x27, 0x01, 0x00, 0x26, 0x00, 0x84, 0x00, 0x23,
+  0x88, 0x27, 0x01, 0x00, 0x28, 0x00, 0x82, 0x00, 0x1D, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00, 0x81,
+  0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x83, 0x00, 0x21, 0x88, 0x27, 0x01, 0x00, 0x26,
+  0x00, 0x82, 0x00, 0x1D, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00, 0x83, 0x00, 0x1F, 0x88, 0x27, 0x01,
+  0x00, 0x2B, 0x00, 0x84, 0x00, 0x1A, 0x88, 0x27, 0x01, 0x00, 0x2A, 0x00, 0x82, 0x00, 0x1B, 0x88,
+  0x27, 0x01, 0x00, 0x27, 0x00, 0x81, 0x00, 0x1E, 0x88, 0x27, 0x00, 0x88, 0x27, 0x01, 0x00, 0x2B,
+  0x00, 0x80, 0x00, 0x21, 0x88, 0x27, 0x01, 0x00, 0x28, 0x00, 0x81, 0x00, 0x1F, 0x88, 0x27, 0x01,
+  0x00, 0x2A, 0x00, 0x83, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00, 0x84, 0x00, 0x23, 0x88,
+  0x27, 0x01, 0x00, 0x26, 0x00, 0x82, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x2A, 0x00, 0x81, 0x00,
+  0x23, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00, 0x80, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0x28, 0x00,
+  0x83, 0x00, 0x21, 0x88, 0x27, 0x01, 0x00, 0x26, 0x00, 0x83, 0x00, 0x1B, 0x88, 0x27, 0x01, 0x00,
+  0x27, 0x00, 0x80, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0x2A, 0x00, 0x80, 0x00, 0x23, 0x88, 0x27,
+  0x01, 0x00, 0x27, 0x00, 0x80, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0x2A, 0x00, 0x84, 0x00, 0x19,
+  0x88, 0x27, 0x01, 0x00, 0x25, 0x00, 0x84, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0x26, 0x00, 0x81,
+  0x00, 0x20, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00, 0x81, 0x00, 0x1A, 0x88, 0x27, 0x01, 0x00, 0x25,
+  0x00, 0x81, 0x00, 0x1D, 0x88, 0x27, 0x01, 0x00, 0x28, 0x00, 0x80, 0x00, 0x1B, 0x88, 0x27, 0x01,
+  0x00, 0x26, 0x00, 0x80, 0x00, 0x1B, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x80, 0x00, 0x23, 0x88,
+  0x27, 0x01, 0x00, 0x2B, 0x00, 0x83, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0x26, 0x00, 0x81, 0x00,
+  0x23, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x84, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00,
+  0x81, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00, 0x80, 0x00, 0x22, 0x88, 0x27, 0x01, 0x00,
+  0x27, 0x00, 0x82, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0x2A, 0x00, 0x83, 0x00, 0x19, 0x88, 0x27,
+  0x01, 0x00, 0x27, 0x00, 0x83, 0x00, 0x1D, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00, 0x81, 0x00, 0x1D,
+  0x88, 0x27, 0x01, 0x00, 0x28, 0x00, 0x80, 0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0x25, 0x00, 0x83,
+  0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0x28, 0x00, 0x80, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x27,
+  0x00, 0x83, 0x00, 0x1B, 0x88, 0x27, 0x01, 0x00, 0x26, 0x00, 0x81, 0x00, 0x1E, 0x88, 0x27, 0x00,
+  0x88, 0x27, 0x00, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00, 0x83, 0x00, 0x1F, 0x88, 0x27, 0x01, 0x00,
+  0x2A, 0x00, 0x84, 0x00, 0x1A, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00, 0x81, 0x00, 0x20, 0x88, 0x27,
+  0x01, 0x00, 0x25, 0x00, 0x83, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00, 0x81, 0x00, 0x20,
+  0x88, 0x27, 0x01, 0x00, 0x26, 0x00, 0x84, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00, 0x81,
+  0x00, 0x1B, 0x88, 0x27, 0x01, 0x00, 0x25, 0x00, 0x83, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0x2A,
+  0x00, 0x84, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00, 0x2A, 0x00, 0x82, 0x00, 0x19, 0x88, 0x27, 0x01,
+  0x00, 0x25, 0x00, 0x82, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00, 0x81, 0x00, 0x1A, 0x88,
+  0x27, 0x01, 0x00, 0x26, 0x00, 0x84, 0x00, 0x1B, 0x88, 0x27, 0x01, 0x00, 0x2A, 0x00, 0x81, 0x00,
+  0x1A, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x82, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00,
+  0x80, 0x00, 0x1B, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00, 0x81, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00,
+  0x28, 0x00, 0x81, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00, 0x82, 0x00, 0x21, 0x88, 0x27,
+  0x01, 0x00, 0x27, 0x00, 0x82, 0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0x28, 0x00, 0x82, 0x00, 0x1C,
+  0x88, 0x27, 0x01, 0x00, 0x2A, 0x00, 0x80, 0x00, 0x1B, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x84,
+  0x00, 0x22, 0x88, 0x27, 0x01, 0x00, 0x25, 0x00, 0x82, 0x00, 0x1A, 0x88, 0x27, 0x01, 0x00, 0x2B,
+  0x00, 0x80, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0x26, 0x00, 0x81, 0x00, 0x19, 0x88, 0x27, 0x01,
+  0x00, 0x27, 0x00, 0x82, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00, 0x80, 0x00, 0x1D, 0x88,
+  0x27, 0x01, 0x00, 0x2A, 0x00, 0x80, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x82, 0x00,
+  0x1F, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00, 0x80, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x2A, 0x00,
+  0x82, 0x00, 0x1D, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x80, 0x00, 0x22, 0x88, 0x27, 0x00, 0x88,
+  0x27, 0x01, 0x00, 0x2A, 0x00, 0x84, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x26, 0x00, 0x84, 0x00,
+  0x1B, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00, 0x80, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00, 0x26, 0x00,
+  0x82, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x83, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00,
+  0x26, 0x00, 0x83, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00, 0x28, 0x00, 0x84, 0x00, 0x21, 0x88, 0x27,
+  0x01, 0x00, 0x29, 0x00, 0x80, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x81, 0x00, 0x20,
+  0x88, 0x27, 0x01, 0x00, 0x2A, 0x00, 0x82, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00, 0x82,
+  0x00, 0x21, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x84, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0x27,
+  0x00, 0x84, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x81, 0x00, 0x1C, 0x88, 0x27, 0x01,
+  0x00, 0x26, 0x00, 0x81, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x26, 0x00, 0x83, 0x00, 0x23, 0x88,
+  0x27, 0x01, 0x00, 0x27, 0x00, 0x80, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x25, 0x00, 0x83, 0x00,
+  0x1B, 0x88, 0x27, 0x01, 0x00, 0x25, 0x00, 0x82, 0x00, 0x22, 0x88, 0x27, 0x01, 0x00, 0x2A, 0x00,
+  0x84, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x27, 0x00, 0x83, 0x00, 0x22, 0x88, 0x27, 0x01, 0x00,
+  0x29, 0x00, 0x82, 0x00, 0x1A, 0x88, 0x27, 0x01, 0x00, 0x26, 0x00, 0x80, 0x00, 0x23, 0x88, 0x27,
+  0x01, 0x00, 0x2B, 0x00, 0x80, 0x00, 0x1A, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00, 0x82, 0x00, 0x1B,
+  0x88, 0x27, 0x01, 0x00, 0x26, 0x00, 0x83, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x2B, 0x00, 0x82,
+  0x00, 0x1B, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00, 0x83, 0x00, 0x1B, 0x88, 0x27, 0x01, 0x00, 0x25,
+  0x00, 0x82, 0x00, 0x1B, 0x88, 0x27, 0x00, 0x88, 0x27, 0x01, 0x00, 0x29, 0x00, 0x82, 0x00, 0x14,
+  0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88,
+  0x27, 0x00, 0x88, 0x27, 0x00
+};
+
+const uint8_t traceTap [] = {  // 46 records
+  0x43, 0x53, 0x54, 0x54, 0x01, 0x05, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88,
+  0x27, 0x01, 0x00, 0x76, 0x00, 0x80, 0x00, 0x1E, 0x88, 0x27, 0x00, 0x88, 0x27, 0x01, 0x00, 0x78,
+  0x00, 0x82, 0x00, 0x1E, 0x88, 0x27, 0x00, 0x88, 0x27, 0x01, 0x00, 0x7A, 0x00, 0x83, 0x00, 0x1B,
+  0x88, 0x27, 0x01, 0x00, 0x79, 0x00, 0x80, 0x00, 0x1A, 0x88, 0x27, 0x01, 0x00, 0x7A, 0x00, 0x83,
+  0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0x77, 0x00, 0x84, 0x00, 0x22, 0x88, 0x27, 0x01, 0x00, 0x78,
+  0x00, 0x81, 0x00, 0x1A, 0x88, 0x27, 0x01, 0x00, 0x78, 0x00, 0x82, 0x00, 0x19, 0x88, 0x27, 0x01,
+  0x00, 0x7A, 0x00, 0x80, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x78, 0x00, 0x80, 0x00, 0x19, 0x88,
+  0x27, 0x01, 0x00, 0x7A, 0x00, 0x82, 0x00, 0x21, 0x88, 0x27, 0x01, 0x00, 0x7A, 0x00, 0x84, 0x00,
+  0x23, 0x88, 0x27, 0x01, 0x00, 0x77, 0x00, 0x83, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x77, 0x00,
+  0x82, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x77, 0x00, 0x81, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00,
+  0x77, 0x00, 0x82, 0x00, 0x22, 0x88, 0x27, 0x01, 0x00, 0x77, 0x00, 0x81, 0x00, 0x19, 0x88, 0x27,
+  0x01, 0x00, 0x79, 0x00, 0x81, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x78, 0x00, 0x84, 0x00, 0x1A,
+  0x88, 0x27, 0x01, 0x00, 0x78, 0x00, 0x84, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0x77, 0x00, 0x83,
+  0x00, 0x20, 0x88, 0x27, 0x01, 0x00, 0x7A, 0x00, 0x84, 0x00, 0x1B, 0x88, 0x27, 0x01, 0x00, 0x76,
+  0x00, 0x82, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0x76, 0x00, 0x81, 0x00, 0x22, 0x88, 0x27, 0x01,
+  0x00, 0x7A, 0x00, 0x84, 0x00, 0x1D, 0x88, 0x27, 0x01, 0x00, 0x76, 0x00, 0x82, 0x00, 0x1F, 0x88,
+  0x27, 0x01, 0x00, 0x7A, 0x00, 0x84, 0x00, 0x21, 0x88, 0x27, 0x01, 0x00, 0x7A, 0x00, 0x80, 0x00,
+  0x1F, 0x88, 0x27, 0x01, 0x00, 0x76, 0x00, 0x81, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x77, 0x00,
+  0x81, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0x78, 0x00, 0x83, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00,
+  0x7A, 0x00, 0x80, 0x00, 0x19, 0x88, 0x27, 0x00, 0x88, 0x27, 0x01, 0x00, 0x78, 0x00, 0x83, 0x00,
+  0x19, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00,
+  0x88, 0x27, 0x00, 0x88, 0x27, 0x00
+};
+
+const uint8_t traceDrag [] = {  // 101 records
+  0x43, 0x53, 0x54, 0x54, 0x01, 0x05, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88,
+  0x27, 0x01, 0x00, 0x77, 0x00, 0x84, 0x00, 0x21, 0x88, 0x27, 0x01, 0x00, 0x79, 0x00, 0x83, 0x00,
+  0x1B, 0x88, 0x27, 0x01, 0x00, 0x79, 0x00, 0x7F, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x7F, 0x00,
+  0x7F, 0x00, 0x1D, 0x88, 0x27, 0x01, 0x00, 0x7C, 0x00, 0x80, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00,
+  0x7A, 0x00, 0x81, 0x00, 0x22, 0x88, 0x27, 0x01, 0x00, 0x7F, 0x00, 0x80, 0x00, 0x1E, 0x88, 0x27,
+  0x01, 0x00, 0x7C, 0x00, 0x81, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0x83, 0x00, 0x85, 0x00, 0x1C,
+  0x88, 0x27, 0x01, 0x00, 0x80, 0x00, 0x80, 0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0x80, 0x00, 0x7F,
+  0x00, 0x1D, 0x88, 0x27, 0x01, 0x00, 0x83, 0x00, 0x84, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x87,
+  0x00, 0x83, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00, 0x85, 0x00, 0x81, 0x00, 0x23, 0x88, 0x27, 0x01,
+  0x00, 0x87, 0x00, 0x85, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x84, 0x00, 0x81, 0x00, 0x23, 0x88,
+  0x27, 0x01, 0x00, 0x8C, 0x00, 0x80, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0x88, 0x00, 0x83, 0x00,
+  0x1C, 0x88, 0x27, 0x01, 0x00, 0x8D, 0x00, 0x85, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0x89, 0x00,
+  0x84, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x8B, 0x00, 0x7F, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00,
+  0x8F, 0x00, 0x85, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x8A, 0x00, 0x85, 0x00, 0x23, 0x88, 0x27,
+  0x01, 0x00, 0x8E, 0x00, 0x83, 0x00, 0x22, 0x88, 0x27, 0x01, 0x00, 0x8E, 0x00, 0x80, 0x00, 0x19,
+  0x88, 0x27, 0x01, 0x00, 0x93, 0x00, 0x81, 0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0x92, 0x00, 0x7F,
+  0x00, 0x1B, 0x88, 0x27, 0x01, 0x00, 0x93, 0x00, 0x84, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0x97,
+  0x00, 0x82, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0x95, 0x00, 0x82, 0x00, 0x1E, 0x88, 0x27, 0x01,
+  0x00, 0x99, 0x00, 0x81, 0x00, 0x21, 0x88, 0x27, 0x01, 0x00, 0x99, 0x00, 0x7F, 0x00, 0x1A, 0x88,
+  0x27, 0x01, 0x00, 0x9C, 0x00, 0x7F, 0x00, 0x1D, 0x88, 0x27, 0x01, 0x00, 0x9D, 0x00, 0x81, 0x00,
+  0x20, 0x88, 0x27, 0x01, 0x00, 0x9E, 0x00, 0x84, 0x00, 0x1D, 0x88, 0x27, 0x01, 0x00, 0x97, 0x00,
+  0x81, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0x9D, 0x00, 0x80, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00,
+  0x9C, 0x00, 0x84, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0xA1, 0x00, 0x81, 0x00, 0x1D, 0x88, 0x27,
+  0x01, 0x00, 0x9F, 0x00, 0x85, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00, 0xA1, 0x00, 0x80, 0x00, 0x21,
+  0x88, 0x27, 0x01, 0x00, 0xA0, 0x00, 0x7F, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0xA6, 0x00, 0x7F,
+  0x00, 0x1D, 0x88, 0x27, 0x01, 0x00, 0xA0, 0x00, 0x7F, 0x00, 0x1B, 0x88, 0x27, 0x01, 0x00, 0xA3,
+  0x00, 0x82, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0xA3, 0x00, 0x84, 0x00, 0x19, 0x88, 0x27, 0x01,
+  0x00, 0xA4, 0x00, 0x81, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0xA6, 0x00, 0x7F, 0x00, 0x1E, 0x88,
+  0x27, 0x01, 0x00, 0xA5, 0x00, 0x84, 0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0xA9, 0x00, 0x85, 0x00,
+  0x19, 0x88, 0x27, 0x01, 0x00, 0xA6, 0x00, 0x81, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00, 0xA7, 0x00,
+  0x7F, 0x00, 0x23, 0x88, 0x27, 0x01, 0x00, 0xB0, 0x00, 0x81, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00,
+  0xAF, 0x00, 0x7F, 0x00, 0x1A, 0x88, 0x27, 0x01, 0x00, 0xAD, 0x00, 0x80, 0x00, 0x1C, 0x88, 0x27,
+  0x01, 0x00, 0xAF, 0x00, 0x82, 0x00, 0x1B, 0x88, 0x27, 0x01, 0x00, 0xB3, 0x00, 0x82, 0x00, 0x22,
+  0x88, 0x27, 0x01, 0x00, 0xB5, 0x00, 0x81, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0xAF, 0x00, 0x83,
+  0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0xB1, 0x00, 0x81, 0x00, 0x21, 0x88, 0x27, 0x01, 0x00, 0xB5,
+  0x00, 0x85, 0x00, 0x1C, 0x88, 0x27, 0x01, 0x00, 0xB9, 0x00, 0x85, 0x00, 0x23, 0x88, 0x27, 0x01,
+  0x00, 0xB7, 0x00, 0x80, 0x00, 0x21, 0x88, 0x27, 0x01, 0x00, 0xBB, 0x00, 0x7F, 0x00, 0x21, 0x88,
+  0x27, 0x01, 0x00, 0xB4, 0x00, 0x80, 0x00, 0x1D, 0x88, 0x27, 0x01, 0x00, 0xB5, 0x00, 0x85, 0x00,
+  0x21, 0x88, 0x27, 0x01, 0x00, 0xBE, 0x00, 0x85, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00, 0xBA, 0x00,
+  0x81, 0x00, 0x22, 0x88, 0x27, 0x01, 0x00, 0xBD, 0x00, 0x85, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00,
+  0xBF, 0x00, 0x81, 0x00, 0x1A, 0x88, 0x27, 0x01, 0x00, 0xC2, 0x00, 0x84, 0x00, 0x1D, 0x88, 0x27,
+  0x01, 0x00, 0xBB, 0x00, 0x7F, 0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0xC4, 0x00, 0x82, 0x00, 0x1E,
+  0x88, 0x27, 0x01, 0x00, 0xC2, 0x00, 0x7F, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0xC4, 0x00, 0x81,
+  0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0xC2, 0x00, 0x7F, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00, 0xC8,
+  0x00, 0x81, 0x00, 0x22, 0x88, 0x27, 0x01, 0x00, 0xC4, 0x00, 0x82, 0x00, 0x19, 0x88, 0x27, 0x01,
+  0x00, 0xC9, 0x00, 0x81, 0x00, 0x21, 0x88, 0x27, 0x01, 0x00, 0xC5, 0x00, 0x81, 0x00, 0x21, 0x88,
+  0x27, 0x01, 0x00, 0xC9, 0x00, 0x7F, 0x00, 0x20, 0x88, 0x27, 0x01, 0x00, 0xC7, 0x00, 0x83, 0x00,
+  0x1D, 0x88, 0x27, 0x01, 0x00, 0xCA, 0x00, 0x83, 0x00, 0x1E, 0x88, 0x27, 0x01, 0x00, 0xC8, 0x00,
+  0x81, 0x00, 0x1F, 0x88, 0x27, 0x01, 0x00, 0xCC, 0x00, 0x85, 0x00, 0x19, 0x88, 0x27, 0x01, 0x00,
+  0xCF, 0x00, 0x7F, 0x00, 0x1A, 0x88, 0x27, 0x01, 0x00, 0xCC, 0x00, 0x84, 0x00, 0x1E, 0x88, 0x27,
+  0x01, 0x00, 0xCB, 0x00, 0x80, 0x00, 0x22, 0x88, 0x27, 0x01, 0x00, 0xD3, 0x00, 0x7F, 0x00, 0x1C,
+  0x88, 0x27, 0x01, 0x00, 0xD1, 0x00, 0x81, 0x00, 0x23, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88,
+  0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27, 0x00, 0x88, 0x27,
+  0x00
+};
+
+#endif
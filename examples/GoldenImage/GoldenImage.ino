@@ -0,0 +1,400 @@
+
+//============================================================================================//
+/*
+  Golden-image test for the CSE_UI widgets.
+
+  Each scene draws one kind of widget (button, list, pagination, string, text area and
+  icons) into an off-screen capture. The references are kept in SPIFFS as raw RGB565
+  files, one per scene.
+
+  Set GOLDEN_RECORD to 1 and run the sketch once on a build you trust to write the
+  references. Set it back to 0 to check later builds against them. A scene that differs
+  prints the number of differing pixels, and writes the capture and a diff image (the
+  differing pixels in red) as BMP files next to the reference. Download the folder with
+  your SPIFFS tool of choice to look at them.
+*/
+//============================================================================================//
+
+#include <Arduino.h>  // Standard libraries
+#include <SPI.h>
+#include <FS.h>
+#include <SPIFFS.h>
+
+#include <TFT_eSPI.h> // TFT LCD library
+#include <CSE_UI.h>
+
+//============================================================================================//
+
+#define  LCD_ROTATION       3   // The LCD panel rotation
+
+#define  GOLDEN_RECORD      0   // 1 to write new references, 0 to compare against them
+#define  GOLDEN_DIR         "/golden" // Folder of the references and the diff images
+
+//============================================================================================//
+// Globals
+
+TFT_eSPI LCD = TFT_eSPI(); // Create a new TFT driver instance
+
+// UI objects. The scenes do not need a touch panel.
+CSE_UI myui (&LCD, NULL);
+captureClass capture (&myui);
+
+fs::FS& goldenFS = SPIFFS;  // Where the references are kept
+
+// Widgets of the scenes
+buttonClass sceneButton (&myui);
+buttonClass iconButton (&myui);
+listClass sceneList (&myui);
+buttonClass listItems [4] = {buttonClass (&myui), buttonClass (&myui), buttonClass (&myui), buttonClass (&myui)};
+paginationClass scenePagination (&myui);
+lcdString sceneString (&myui);
+textAreaClass sceneTextArea (&myui);
+iconClass plusIcon (&myui);
+iconClass ringIcon (&myui);
+
+// A plus sign, span-encoded. 16 x 16 cell, 12 x 12 glyph at (2, 2).
+const uint8_t plusSpans [] = {
+  0xC5, 0x10, 0x10, 0x02, 0x02, 0x0C, 0x0C, 0x00,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04,
+  0x01, 0x00, 0x0C, 0x01, 0x00, 0x0C, 0x01, 0x00, 0x0C, 0x01, 0x00, 0x0C,
+  0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x04, 0x04
+};
+
+// An anti-aliased ring, 4-bit alpha. 16 x 16 cell, 12 x 12 glyph at (2, 2).
+const uint8_t ringAlpha [] = {
+  0xA4, 0x10, 0x10, 0x02, 0x02, 0x0C, 0x0C, 0x00,
+  0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x00, 0x26, 0x9B, 0xB9, 0x62, 0x00,
+  0x02, 0x8D, 0xEC, 0xCE, 0xD8, 0x20, 0x06, 0xDC, 0x74, 0x47, 0xCD, 0x60,
+  0x29, 0xE7, 0x10, 0x01, 0x7E, 0x92, 0x4B, 0xC4, 0x00, 0x00, 0x4C, 0xB4,
+  0x4B, 0xC4, 0x00, 0x00, 0x4C, 0xB4, 0x29, 0xE7, 0x10, 0x01, 0x7E, 0x92,
+  0x06, 0xDC, 0x74, 0x47, 0xCD, 0x60, 0x02, 0x8D, 0xEC, 0xCE, 0xD8, 0x20,
+  0x00, 0x26, 0x9B, 0xB9, 0x62, 0x00, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00
+};
+
+typedef void (*sceneFunc)();
+
+struct goldenScene {
+  const char* name;
+  int16_t x;  // Captured region in screen coordinates
+  int16_t y;
+  int16_t w;
+  int16_t h;
+  sceneFunc draw;
+};
+
+//============================================================================================//
+// Forward Declarations
+
+void setup (void);
+void loop (void);
+
+bool initLCD (void);
+bool runScene (const goldenScene& scene);
+bool recordScene (const goldenScene& scene, const String& path);
+bool compareScene (const goldenScene& scene, const String& path);
+void writeImage (const String& path, const uint16_t* reference);
+
+void drawButtonScene (void);
+void drawListScene (void);
+void drawPaginationScene (void);
+void drawStringScene (void);
+void drawTextAreaScene (void);
+void drawIconScene (void);
+
+const goldenScene goldenScenes [] = {
+  {"button", 0, 0, 160, 60, drawButtonScene},
+  {"list", 0, 0, 140, 120, drawListScene},
+  {"pagination", 0, 0, 160, 40, drawPaginationScene},
+  {"string", 0, 0, 200, 40, drawStringScene},
+  {"textarea", 0, 0, 200, 100, drawTextAreaScene},
+  {"icon", 0, 0, 120, 40, drawIconScene}
+};
+
+//============================================================================================//
+/**
+ * @brief Setup runs once.
+ *
+ */
+void setup() {
+  Serial.begin (115200);
+  delay (2000);
+
+  Serial.println();
+  Serial.println (F("=== CSE_UI - Golden Image Test ==="));
+
+  initLCD();
+
+  if (!SPIFFS.begin (true)) {
+    Serial.println (F("setup [ERROR]: SPIFFS could not be mounted."));
+    return;
+  }
+
+  if (!goldenFS.exists (GOLDEN_DIR)) {
+    goldenFS.mkdir (GOLDEN_DIR);
+  }
+
+  uint8_t failed = 0;
+  uint8_t count = sizeof (goldenScenes) / sizeof (goldenScenes [0]);
+
+  for (uint8_t i = 0; i < count; i++) {
+    if (!runScene (goldenScenes [i])) failed++;
+  }
+
+  Serial.println();
+
+  if (GOLDEN_RECORD) {
+    Serial.print (F("setup [INFO]: References written: "));
+    Serial.println (count - failed);
+  }
+  else if (failed == 0) {
+    Serial.println (F("setup [INFO]: PASS"));
+  }
+  else {
+    Serial.print (F("setup [ERROR]: FAIL, scenes that differ: "));
+    Serial.println (failed);
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Infinite loop.
+ *
+ */
+void loop() {
+  delay (1000);
+}
+
+//============================================================================================//
+/**
+ * @brief Initialize the LCD.
+ *
+ * @return true
+ * @return false
+ */
+bool initLCD() {
+  LCD.begin();
+  LCD.setRotation (LCD_ROTATION);
+  LCD.fillScreen (TFT_BLACK);
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Draws one scene into the capture buffer, then records or checks it.
+ *
+ * @param scene
+ * @return true The reference was written, or the capture matches it.
+ * @return false The capture could not be made, or it does not match.
+ */
+bool runScene (const goldenScene& scene) {
+  String path = String (GOLDEN_DIR) + "/" + scene.name;
+
+  if (!capture.begin (scene.x, scene.y, scene.w, scene.h)) {
+    Serial.print (F("runScene [ERROR]: Not enough memory to capture "));
+    Serial.println (scene.name);
+    return false;
+  }
+
+  LCD.setTextFont (2);
+  LCD.setTextSize (1);
+
+  capture.start (TFT_BLACK);
+  scene.draw();
+  capture.stop();
+
+  bool result = GOLDEN_RECORD ? recordScene (scene, path) : compareScene (scene, path);
+
+  capture.end();
+  return result;
+}
+
+//============================================================================================//
+/**
+ * @brief Writes the capture as the reference of the scene.
+ *
+ * @param scene
+ * @param path Path of the scene files, without the extension.
+ * @return true
+ * @return false
+ */
+bool recordScene (const goldenScene& scene, const String& path) {
+  fs::File file = goldenFS.open (path + ".raw", FILE_WRITE);
+
+  if (!file) {
+    Serial.print (F("recordScene [ERROR]: Could not create "));
+    Serial.println (path + ".raw");
+    return false;
+  }
+
+  capture.writeRaw (file);
+  file.close();
+
+  Serial.print (F("recordScene [INFO]: "));
+  Serial.print (scene.name);
+  Serial.print (F(", crc = 0x"));
+  Serial.println (capture.checksum(), HEX);
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Compares the capture with the reference of the scene. If they differ, the
+ * capture and a diff image are written as BMP files.
+ *
+ * @param scene
+ * @param path Path of the scene files, without the extension.
+ * @return true
+ * @return false
+ */
+bool compareScene (const goldenScene& scene, const String& path) {
+  uint32_t size = (uint32_t) scene.w * scene.h * 2;
+  fs::File file = goldenFS.open (path + ".raw", FILE_READ);
+
+  if ((!file) || (file.size() != size)) {
+    Serial.print (F("compareScene [ERROR]: No valid reference for "));
+    Serial.println (scene.name);
+    writeImage (path, NULL);
+    return false;
+  }
+
+  uint16_t* reference = (uint16_t*) malloc (size);
+
+  if (reference == NULL) {
+    Serial.print (F("compareScene [ERROR]: Not enough memory to load "));
+    Serial.println (path + ".raw");
+    file.close();
+    return false;
+  }
+
+  file.read ((uint8_t*) reference, size);  // Low byte first, as on the ESP32
+  file.close();
+
+  uint32_t diff = capture.compare (reference);
+
+  Serial.print (F("compareScene [INFO]: "));
+  Serial.print (scene.name);
+  Serial.print (F(", differing pixels = "));
+  Serial.println (diff);
+
+  if (diff > 0) {
+    writeImage (path, reference);
+  }
+
+  free (reference);
+  return diff == 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Writes the capture as a BMP file, and the diff with the reference if given.
+ *
+ * @param path Path of the scene files, without the extension.
+ * @param reference The reference pixels, or NULL.
+ */
+void writeImage (const String& path, const uint16_t* reference) {
+  fs::File file = goldenFS.open (path + ".bmp", FILE_WRITE);
+
+  if (file) {
+    capture.writeBMP (file);
+    file.close();
+  }
+
+  if (reference == NULL) return;
+
+  file = goldenFS.open (path + "_diff.bmp", FILE_WRITE);
+
+  if (file) {
+    capture.writeDiffBMP (reference, file);
+    file.close();
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief A filled button with a border and a centered label.
+ *
+ */
+void drawButtonScene() {
+  sceneButton.initialize (10, 10, 140, 40, TFT_BLUE, TFT_WHITE, "Golden");
+  sceneButton.borderVisible = true;
+  sceneButton.borderColor = TFT_WHITE;
+  sceneButton.updateState (true);
+  sceneButton.draw();
+}
+
+//============================================================================================//
+/**
+ * @brief A list of four items with the second one focused.
+ *
+ */
+void drawListScene() {
+  if (sceneList.itemCount == 0) {
+    sceneList.initialize (10, 10, 120, 25, TFT_WHITE, TFT_BLACK, TFT_BLACK, TFT_WHITE);
+
+    for (int i = 0; i < 4; i++) {
+      sceneList.addItem (&listItems [i], String ("Item ") + String (i + 1));
+    }
+    sceneList.itemVisibleCount = 4;
+  }
+
+  sceneList.setCurrentItem (1);
+  sceneList.triggerStateChange();
+  sceneList.draw();
+}
+
+//============================================================================================//
+/**
+ * @brief A pagination widget on page 3 of 7.
+ *
+ */
+void drawPaginationScene() {
+  scenePagination.initialize (10, 5, 140, 30, 7, TFT_BLUE, TFT_WHITE, TFT_WHITE);
+  scenePagination.setCurrentValue (3);
+  scenePagination.draw();
+}
+
+//============================================================================================//
+/**
+ * @brief A string drawn, then updated to a shorter one, so the clearing of the old text
+ * is part of the image.
+ *
+ */
+void drawStringScene() {
+  sceneString.initialize ("Golden image test", 10, 10, TFT_YELLOW, TFT_BLACK, true);
+  sceneString.draw();
+  sceneString.update ("Updated");
+  sceneString.draw();
+}
+
+//============================================================================================//
+/**
+ * @brief A text area with wrapped text.
+ *
+ */
+void drawTextAreaScene() {
+  sceneTextArea.initialize (5, 5, 190, 90, TFT_WHITE, TFT_BLACK, TFT_WHITE, "Notes");
+  sceneTextArea.setText ("The quick brown fox jumps over the lazy dog. 0123456789");
+  sceneTextArea.draw();
+}
+
+//============================================================================================//
+/**
+ * @brief A span-encoded and an anti-aliased icon, drawn alone and on a button.
+ *
+ */
+void drawIconScene() {
+  plusIcon.initializeSpans (plusSpans, 0x002B, "plus");
+  ringIcon.initializeAlpha (ringAlpha, 0x25CB, "ring");
+
+  plusIcon.draw (4, 12, TFT_GREEN);
+  ringIcon.drawAlpha (28, 12, TFT_WHITE, TFT_BLACK);
+
+  iconButton.initialize (56, 4, 60, 32, TFT_BLUE, TFT_WHITE, "");
+  iconButton.icon = &ringIcon;
+  iconButton.iconVisible = true;
+  iconButton.labelVisible = false;
+  iconButton.updateState (true);
+  iconButton.draw();
+}
+
+//============================================================================================//
@@ -0,0 +1,350 @@
+
+//============================================================================================//
+/*
+  Scaling benchmark for CSE_UI.
+
+  Sweeps the number of buttons on a page, the length of a list and the text size, and
+  prints one line per configuration with:
+
+    frame_us   Average CPU time of a frame in microseconds.
+    max_us     Slowest frame.
+    heap_peak  Most heap in use during the run, in bytes, above what was in use before
+               the widgets were created. Sampled after every frame.
+    bus_bytes  Bytes sent to the display per frame, counted as 2 bytes per pixel drawn.
+               Needs CSEUI_ENABLE_PROFILER; printed as 0 otherwise.
+
+  The page runs change the label of one button per frame, so only that button should be
+  drawn. The list runs move the focus by one item per frame, wrapping at the end. In
+  both cases the frame time should stay flat as the counts grow. A time that grows with
+  the count points to work that is done for every widget or item instead of for the
+  ones that changed.
+
+  Configurations that run out of memory are reported and skipped. Build with
+  CSEUI_ENABLE_PROFILER defined to get the bus bytes.
+*/
+//============================================================================================//
+
+#include <Arduino.h>  // Standard libraries
+#include <SPI.h>
+#include <new>
+#if defined(__GLIBC__)
+  #include <malloc.h> // mallinfo() on host builds
+#endif
+
+#include <TFT_eSPI.h> // TFT LCD library
+#include <CSE_UI.h>
+
+//============================================================================================//
+
+#define  LCD_ROTATION       3   // The LCD panel rotation
+
+#define  BENCH_FRAMES       200   // Frames measured per configuration
+
+//============================================================================================//
+// Globals
+
+TFT_eSPI LCD = TFT_eSPI(); // Create a new TFT driver instance
+
+// UI objects. The benchmark does not need a touch panel.
+CSE_UI myui (&LCD, NULL);
+
+const uint16_t buttonCounts [] = {10, 50, 100, 500};
+const uint16_t listLengths [] = {10, 100, 1000, 10000};
+const uint8_t textSizes [] = {1, 2, 3};
+
+// Statistics of the current run
+uint32_t totalTime;
+uint32_t maxTime;
+uint32_t heapBase;  // Heap in use before the widgets were created
+uint32_t heapHigh;  // Most heap in use seen during the run
+uint64_t totalPixels;
+
+//============================================================================================//
+// Forward Declarations
+
+void setup (void);
+void loop (void);
+
+bool initLCD (void);
+uint32_t getUsedHeap (void);
+void beginRun (void);
+void beginFrame (void);
+void endFrame (uint32_t start);
+void printColumn (uint32_t value, uint8_t width);
+void printRun (const char* name, uint16_t count, uint8_t textSize);
+void printOutOfMemory (const char* name, uint16_t count, uint8_t textSize);
+void runPage (uint16_t count, uint8_t textSize);
+void runList (uint16_t length, uint8_t textSize);
+
+//============================================================================================//
+/**
+ * @brief Setup runs once.
+ *
+ */
+void setup() {
+  Serial.begin (115200);
+  delay (2000);
+
+  Serial.println();
+  Serial.println (F("=== CSE_UI - Scaling Benchmark ==="));
+
+  initLCD();
+
+#if !defined(CSEUI_ENABLE_PROFILER)
+  Serial.println (F("setup [INFO]: CSEUI_ENABLE_PROFILER is not defined; bus_bytes will be 0."));
+#endif
+
+  Serial.println (F("test        count  text  frame_us  max_us  heap_peak  bus_bytes"));
+
+  for (uint8_t t = 0; t < sizeof (textSizes); t++) {
+    for (uint8_t i = 0; i < (sizeof (buttonCounts) / sizeof (buttonCounts [0])); i++) {
+      runPage (buttonCounts [i], textSizes [t]);
+    }
+  }
+
+  for (uint8_t t = 0; t < sizeof (textSizes); t++) {
+    for (uint8_t i = 0; i < (sizeof (listLengths) / sizeof (listLengths [0])); i++) {
+      runList (listLengths [i], textSizes [t]);
+    }
+  }
+
+  Serial.println (F("setup [INFO]: Done."));
+}
+
+//============================================================================================//
+/**
+ * @brief Infinite loop.
+ *
+ */
+void loop() {
+  delay (1000);
+}
+
+//============================================================================================//
+/**
+ * @brief Initialize the LCD.
+ *
+ * @return true
+ * @return false
+ */
+bool initLCD() {
+  LCD.begin();
+  LCD.setRotation (LCD_ROTATION);
+  LCD.fillScreen (TFT_BLACK);
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the heap in use in bytes, or 0 where it is not known.
+ *
+ * @return uint32_t
+ */
+uint32_t getUsedHeap() {
+#if defined(ARDUINO_ARCH_ESP32)
+  return ESP.getHeapSize() - ESP.getFreeHeap();
+#elif defined(__GLIBC__)
+  return mallinfo().uordblks;
+#else
+  return 0;
+#endif
+}
+
+//============================================================================================//
+/**
+ * @brief Clears the statistics. Call this before the widgets of a run are created.
+ *
+ */
+void beginRun() {
+  totalTime = 0;
+  maxTime = 0;
+  totalPixels = 0;
+  heapBase = getUsedHeap();
+  heapHigh = heapBase;
+}
+
+//============================================================================================//
+/**
+ * @brief Starts a measured frame.
+ *
+ */
+void beginFrame() {
+  myui.beginFrame();
+}
+
+//============================================================================================//
+/**
+ * @brief Ends a measured frame and adds it to the statistics.
+ *
+ * @param start micros() at the start of the frame.
+ */
+void endFrame (uint32_t start) {
+  myui.endFrame();
+
+  uint32_t elapsed = micros() - start;
+  uint32_t heap = getUsedHeap();
+
+  totalTime += elapsed;
+  if (elapsed > maxTime) maxTime = elapsed;
+  if (heap > heapHigh) heapHigh = heap;
+
+#if defined(CSEUI_ENABLE_PROFILER)
+  totalPixels += myui.profiler.framePixels;
+#endif
+}
+
+//============================================================================================//
+/**
+ * @brief Prints a number right-aligned in a column of the given width.
+ *
+ * @param value
+ * @param width
+ */
+void printColumn (uint32_t value, uint8_t width) {
+  String text = String (value);
+
+  for (int i = text.length(); i < width; i++) Serial.print (' ');
+  Serial.print (text);
+}
+
+//============================================================================================//
+/**
+ * @brief Prints the statistics of a run.
+ *
+ * @param name Name of the test.
+ * @param count Number of buttons or list items.
+ * @param textSize Text size of the run.
+ */
+void printRun (const char* name, uint16_t count, uint8_t textSize) {
+  Serial.print (name);
+  for (int i = strlen (name); i < 7; i++) Serial.print (' ');
+  printColumn (count, 10);
+  printColumn (textSize, 6);
+  printColumn (totalTime / BENCH_FRAMES, 10);
+  printColumn (maxTime, 8);
+  printColumn (heapHigh - heapBase, 11);
+  printColumn ((uint32_t) ((totalPixels * 2) / BENCH_FRAMES), 11);
+  Serial.println();
+}
+
+//============================================================================================//
+/**
+ * @brief Reports a run that could not create its widgets.
+ *
+ * @param name Name of the test.
+ * @param count Number of buttons or list items.
+ * @param textSize Text size of the run.
+ */
+void printOutOfMemory (const char* name, uint16_t count, uint8_t textSize) {
+  Serial.print (name);
+  for (int i = strlen (name); i < 7; i++) Serial.print (' ');
+  printColumn (count, 10);
+  printColumn (textSize, 6);
+  Serial.println (F("  out of memory"));
+}
+
+//============================================================================================//
+/**
+ * @brief Measures a page of buttons, with one button label changed per frame.
+ *
+ * @param count Number of buttons on the page.
+ * @param textSize Text size of the labels.
+ */
+void runPage (uint16_t count, uint8_t textSize) {
+  beginRun();
+
+  pageClass* page = new (std::nothrow) pageClass (&myui, 0);
+  buttonClass** buttons = new (std::nothrow) buttonClass* [count];
+  uint16_t created = 0;
+
+  if ((page != NULL) && (buttons != NULL)) {
+    for (; created < count; created++) {
+      buttons [created] = new (std::nothrow) buttonClass (&myui);
+      if (buttons [created] == NULL) break;
+
+      // A grid of 16 x 9 cells, 20 to a row. 500 buttons fill a 320 x 240 screen.
+      int16_t x = (created % 20) * 16;
+      int16_t y = (created / 20) * 9;
+      buttons [created]->initialize (x, y, 15, 8, TFT_BLUE, TFT_WHITE, String (created));
+      page->addWidget (buttons [created]);
+    }
+  }
+
+  if (created == count) {
+    LCD.setTextSize (textSize);
+    page->setActive();
+    page->draw(); // The first draw is not measured
+
+    for (uint16_t f = 0; f < BENCH_FRAMES; f++) {
+      uint32_t start = micros();
+      beginFrame();
+      buttons [f % count]->setLabel (String ("f") + String (f)); // Differs from the initial label
+      page->draw();
+      endFrame (start);
+    }
+
+    printRun ("page", count, textSize);
+  }
+  else {
+    printOutOfMemory ("page", count, textSize);
+  }
+
+  for (uint16_t i = 0; i < created; i++) {
+    delete buttons [i];
+  }
+  delete [] buttons;
+  delete page;
+}
+
+//============================================================================================//
+/**
+ * @brief Measures a list, with the focus moved by one item per frame.
+ *
+ * @param length Number of items in the list.
+ * @param textSize Text size of the labels.
+ */
+void runList (uint16_t length, uint8_t textSize) {
+  beginRun();
+
+  listClass* list = new (std::nothrow) listClass (&myui);
+  buttonClass** items = new (std::nothrow) buttonClass* [length];
+  uint16_t created = 0;
+
+  if ((list != NULL) && (items != NULL)) {
+    list->initialize (0, 0, 200, 24, TFT_WHITE, TFT_BLACK, TFT_BLACK, TFT_WHITE);
+    list->reserveItems (length);
+
+    for (; created < length; created++) {
+      items [created] = new (std::nothrow) buttonClass (&myui);
+      if (items [created] == NULL) break;
+      list->addItem (items [created], String ("Item ") + String (created));
+    }
+    list->itemVisibleCount = 8;
+  }
+
+  if (created == length) {
+    LCD.setTextSize (textSize);
+    list->draw(); // The first draw is not measured
+
+    for (uint16_t f = 0; f < BENCH_FRAMES; f++) {
+      uint32_t start = micros();
+      beginFrame();
+      list->toNextItem();
+      list->draw();
+      endFrame (start);
+    }
+
+    printRun ("list", length, textSize);
+  }
+  else {
+    printOutOfMemory ("list", length, textSize);
+  }
+
+  for (uint16_t i = 0; i < created; i++) {
+    delete items [i];
+  }
+  delete [] items;
+  delete list;
+}
+
+//============================================================================================//
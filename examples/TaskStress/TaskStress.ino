@@ -0,0 +1,325 @@
+
+//============================================================================================//
+/*
+  Stress test for the render/input task split of CSE_UI.
+
+  The touch panel is replaced by a synthetic replay of taps and slide-offs. The input task
+  dispatches the widget events, the render task draws two buttons, and the loop changes
+  one of the buttons from a third task. Every change is a pair of members (label and fill
+  color) made under lockState(), and the render function checks that it never sees one
+  half of a pair without the other. The tasks are stopped and started several times to
+  check that endTasks() waits for both tasks to exit.
+
+  The expected result is no torn reads, presses on the tap button only, and cancels (not
+  presses) on the slide button.
+
+  The same test runs on a PC, with the tasks on two std::threads, through
+  tools/host/TaskStressHost.cpp.
+*/
+//============================================================================================//
+
+#include <Arduino.h>  // Standard libraries
+#include <SPI.h>
+
+#include <TFT_eSPI.h> // TFT LCD library
+#include <CSE_UI.h>
+
+//============================================================================================//
+
+#define  LCD_ROTATION       3   // The LCD panel rotation
+
+#define  STRESS_CYCLES      10    // Number of beginTasks()/endTasks() cycles
+#define  STRESS_CYCLE_MS    2000  // Run time of each cycle
+#define  STRESS_GESTURES    40    // Tap and slide-off pairs in the replay trace
+#define  STRESS_HOLD        3     // Input steps each sample is held for
+
+#define  TRACE_SIZE         (CSEUI_TRACE_HEADER_SIZE + (STRESS_GESTURES * 28 * STRESS_HOLD))
+
+//============================================================================================//
+// Globals
+
+TFT_eSPI LCD = TFT_eSPI(); // Create a new TFT driver instance
+
+// UI objects. There is no touch panel; the replay stands in for it.
+CSE_UI myui (&LCD, NULL);
+touchReplayClass replay;
+
+buttonClass tapButton (&myui);  // Changed by the loop
+buttonClass slideButton (&myui);  // Changed by the event handler
+
+uint8_t traceData [TRACE_SIZE];
+uint32_t traceLength = 0;
+
+volatile uint32_t frameCount = 0;
+volatile uint32_t tornCount = 0;
+volatile uint32_t tapPresses = 0;
+volatile uint32_t slidePresses = 0;
+volatile uint32_t slideCancels = 0;
+
+uint8_t cycleCount = 0;
+bool testDone = false;
+bool testPassed = false;
+
+//============================================================================================//
+// Forward Declarations
+
+void setup (void);
+void loop (void);
+
+bool initLCD (void);
+void buildTrace (void);
+void addPoint (int16_t x, int16_t y);
+void addRelease (void);
+void setPair (buttonClass& button, bool first);
+bool isPairValid (buttonClass& button);
+void renderPage (void);
+void onEvent (const CSE_UI_Event& event);
+void printResult (void);
+
+//============================================================================================//
+/**
+ * @brief Setup runs once.
+ *
+ */
+void setup() {
+  Serial.begin (115200);
+  delay (2000);
+
+  Serial.println();
+  Serial.println (F("=== CSE_UI - Task Stress Test ==="));
+
+  initLCD();
+
+  tapButton.initialize (20, 20, 120, 60, TFT_RED, TFT_WHITE, "A");
+  slideButton.initialize (20, 120, 120, 60, TFT_RED, TFT_WHITE, "A");
+
+  buildTrace();
+  replay.begin (traceData, traceLength, false); // One record per input step
+
+  myui.setTouchReplay (&replay);
+  myui.setRenderFunction (renderPage);
+  myui.setEventHandler (onEvent);
+
+  if (!myui.beginTasks (0, 1)) {
+    Serial.println (F("setup [ERROR]: Tasks are not supported on this target."));
+    testDone = true;
+    return;
+  }
+
+  Serial.println (F("setup [INFO]: Tasks started."));
+}
+
+//============================================================================================//
+/**
+ * @brief Infinite loop. Flips the tap button between its two states as fast as possible,
+ * and restarts the tasks at the end of every cycle.
+ *
+ */
+void loop() {
+  if (testDone) {
+    delay (1000);
+    return;
+  }
+
+  uint32_t start = millis();
+  bool first = false;
+
+  while ((millis() - start) < STRESS_CYCLE_MS) {
+    myui.lockState();
+    setPair (tapButton, first);
+    myui.unlockState();
+    first = !first;
+    delay (1);
+  }
+
+  myui.endTasks(); // Returns only after both tasks have exited
+
+  if (myui.isRunningTasks()) {
+    Serial.println (F("loop [ERROR]: Tasks still running after endTasks()."));
+  }
+
+  cycleCount++;
+
+  Serial.print (F("loop [INFO]: Cycle "));
+  Serial.print (cycleCount);
+  Serial.print (F(", frames = "));
+  Serial.print (frameCount);
+  Serial.print (F(", torn = "));
+  Serial.println (tornCount);
+
+  if (cycleCount >= STRESS_CYCLES) {
+    printResult();
+    testDone = true;
+    return;
+  }
+
+  replay.rewind(); // Safe; neither task is running
+  myui.beginTasks (0, 1);
+}
+
+//============================================================================================//
+/**
+ * @brief Initialize the LCD.
+ *
+ * @return true
+ * @return false
+ */
+bool initLCD() {
+  LCD.begin();
+  LCD.setRotation (LCD_ROTATION);
+  LCD.fillScreen (TFT_BLACK);
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Builds the replay trace. Each tap presses and lifts inside the tap button. Each
+ * slide-off presses inside the slide button, moves out of it and lifts outside.
+ *
+ */
+void buildTrace() {
+  traceData [0] = 'C';
+  traceData [1] = 'S';
+  traceData [2] = 'T';
+  traceData [3] = 'T';
+  traceData [4] = CSEUI_TRACE_VERSION;
+  traceData [5] = CSEUI_TOUCH_MAX_POINTS;
+  traceLength = CSEUI_TRACE_HEADER_SIZE;
+
+  for (int i = 0; i < STRESS_GESTURES; i++) {
+    addPoint (80, 50);  // Tap
+    addRelease();
+    addPoint (80, 150); // Slide-off
+    addPoint (220, 150);
+    addRelease();
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Adds a one-point sample to the trace, held for STRESS_HOLD records.
+ *
+ * @param x
+ * @param y
+ */
+void addPoint (int16_t x, int16_t y) {
+  for (int i = 0; i < STRESS_HOLD; i++) {
+    traceData [traceLength++] = 0;  // Time delta, not used in step mode
+    traceData [traceLength++] = 1;  // Point count
+    traceData [traceLength++] = 0;  // ID
+    traceData [traceLength++] = x & 0xFF;
+    traceData [traceLength++] = x >> 8;
+    traceData [traceLength++] = y & 0xFF;
+    traceData [traceLength++] = y >> 8;
+    traceData [traceLength++] = 50; // Pressure
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Adds a sample with no points to the trace, held for STRESS_HOLD records.
+ *
+ */
+void addRelease() {
+  for (int i = 0; i < STRESS_HOLD; i++) {
+    traceData [traceLength++] = 0;
+    traceData [traceLength++] = 0;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the label and fill color of a button as a pair. The caller must hold the
+ * state lock.
+ *
+ * @param button
+ * @param first true for "A" on red, false for "B" on blue.
+ */
+void setPair (buttonClass& button, bool first) {
+  if (first) {
+    button.labelString = "A";
+    button.fillColor = TFT_RED;
+  }
+  else {
+    button.labelString = "B";
+    button.fillColor = TFT_BLUE;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Checks that the label and fill color of a button belong to the same pair.
+ *
+ * @param button
+ * @return true
+ * @return false
+ */
+bool isPairValid (buttonClass& button) {
+  if (button.labelString == "A") return button.fillColor == TFT_RED;
+  if (button.labelString == "B") return button.fillColor == TFT_BLUE;
+  return false;
+}
+
+//============================================================================================//
+/**
+ * @brief Runs on the render task once per frame, with the state lock held.
+ *
+ */
+void renderPage() {
+  if (!isPairValid (tapButton)) tornCount++;
+  if (!isPairValid (slideButton)) tornCount++;
+
+  tapButton.isTouched();
+  slideButton.isTouched();
+  tapButton.draw();
+  slideButton.draw();
+
+  frameCount++;
+}
+
+//============================================================================================//
+/**
+ * @brief Runs on the input task for every widget event.
+ *
+ * @param event
+ */
+void onEvent (const CSE_UI_Event& event) {
+  if (event.widget == &tapButton) {
+    if (event.type == CSEUI_EVENT_PRESS) tapPresses++;
+  }
+  else if (event.widget == &slideButton) {
+    if (event.type == CSEUI_EVENT_PRESS) slidePresses++;
+
+    if (event.type == CSEUI_EVENT_CANCEL) {
+      slideCancels++;
+      myui.lockState();
+      setPair (slideButton, (slideCancels & 1) != 0);
+      myui.unlockState();
+    }
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Prints the totals and the verdict.
+ *
+ */
+void printResult() {
+  Serial.println();
+  Serial.print (F("printResult [INFO]: Frames = "));
+  Serial.println (frameCount);
+  Serial.print (F("printResult [INFO]: Tap presses = "));
+  Serial.println (tapPresses);
+  Serial.print (F("printResult [INFO]: Slide presses = "));
+  Serial.println (slidePresses);
+  Serial.print (F("printResult [INFO]: Slide cancels = "));
+  Serial.println (slideCancels);
+  Serial.print (F("printResult [INFO]: Torn reads = "));
+  Serial.println (tornCount);
+
+  testPassed = (tornCount == 0) && (slidePresses == 0) && (tapPresses > 0) && (slideCancels > 0) && (!myui.isRunningTasks());
+
+  Serial.println (testPassed ? F("printResult [INFO]: PASS") : F("printResult [ERROR]: FAIL"));
+}
+
+//============================================================================================//
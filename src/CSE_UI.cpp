@@ -9,7 +9,7 @@
   Version: 0.0.8
   License: MIT
   Source: https://github.com/CIRCUITSTATE/CSE_CST328
-  Last Modified: +05:30 01:05:25 AM 02-03-2025, Sunday
+  Last Modified: +05:30 08:31:57 AM 21-10-2026, Wednesday
  */
 //============================================================================================//
 
@@ -22,6 +22,638 @@ CSE_UI:: CSE_UI (TFT_eSPI* lcd, CSE_Touch* ts) {
   tsParent = ts;
   currentPage = -1;
   prevPage = -1;
+
+  renderFunction = NULL;
+  eventHandler = NULL;
+  tasksRunning = false;
+  frameActive = false;
+  touchSampleTime = 0;
+  touchSampleValid = false;
+  touchChanged = false;
+  touchFrame.count = 0;
+  touchFrame.timestamp = 0;
+  prevTouchFrame.count = 0;
+  prevTouchFrame.timestamp = 0;
+  lastInputFrame.count = 0;
+  lastInputFrame.timestamp = 0;
+  gestureEnabled = false;
+  touchRecorder = NULL;
+  touchReplay = NULL;
+  iconAtlas = NULL;
+  originX = 0;
+  originY = 0;
+  clipActive = false;
+  clipExact = true;
+  clipX = 0;
+  clipY = 0;
+  clipWidth = 0;
+  clipHeight = 0;
+  firstPage = NULL;
+  activePage = NULL;
+  pageTransition = NULL;
+  pageBudget = CSEUI_PAGE_DEF_BUDGET;
+  pageUseCounter = 0;
+  focusWidget = NULL;
+  modalDialog = NULL;
+  tickTime = 0;
+  tickDrawn = 0;
+  tickPending = 0;
+
+  for (int i = 0; i < CSEUI_TOUCH_MAX_POINTS; i++) {
+    touchOwner [i] = NULL;
+  }
+
+#if defined(ARDUINO_ARCH_ESP32)
+  inputTask = NULL;
+  renderTask = NULL;
+  taskExit = xSemaphoreCreateCounting (2, 0);
+#endif
+}
+
+//============================================================================================//
+/**
+ * @brief Reads all active points of the touch panel into a touch frame and passes them
+ * through the touch filter. The ID of each point is the ID the driver reports for it,
+ * which stays the same for as long as the finger stays on the panel. If a replay is
+ * set, the raw points come from the replay instead. If a recorder is set, the raw
+ * points are recorded before filtering.
+ * 
+ * @param frame The frame to fill.
+ * @return true The panel is being touched.
+ * @return false The panel is not touched or there is no touch panel.
+ */
+bool CSE_UI:: sampleTouch (CSE_UI_TouchFrame& frame) {
+  frame.count = 0;
+  frame.timestamp = micros();
+
+  if (touchReplay != NULL) {
+    touchReplay->read (frame);
+  }
+  else if (tsParent != NULL) {
+    readPanel (frame);
+  }
+
+  if ((touchRecorder != NULL) && touchRecorder->isRecording()) {
+    touchRecorder->record (frame);
+  }
+
+  touchFilter.apply (frame);
+
+  return frame.count > 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Reads the raw points of the touch panel into a frame. The points keep the IDs
+ * the driver gives them. Drivers that do not track fingers report the same ID for every
+ * point, or IDs out of range. In that case the slot index is used as the ID instead.
+ * Slot indices are not stable; when one finger lifts, the fingers after it move down a
+ * slot, so a widget held by one of them may see its touch jump or end early.
+ * 
+ * @param frame The frame to fill. The count must be 0.
+ */
+void CSE_UI:: readPanel (CSE_UI_TouchFrame& frame) {
+  uint8_t touches = tsParent->getTouches();
+  uint32_t usedIds = 0; // One bit per ID seen in this frame
+  bool tracked = true;  // The driver reports unique IDs
+
+  if (touches > CSEUI_TOUCH_MAX_POINTS) {
+    touches = CSEUI_TOUCH_MAX_POINTS;
+  }
+
+  for (uint8_t i = 0; i < touches; i++) {
+    CSE_TouchPoint p = tsParent->getPoint (i);
+    frame.points [frame.count].x = p.x;
+    frame.points [frame.count].y = p.y;
+    frame.points [frame.count].z = p.z;
+    frame.points [frame.count].id = p.id;
+    frame.count++;
+
+    if ((p.id >= CSEUI_TOUCH_MAX_POINTS) || (usedIds & (1UL << p.id))) {
+      tracked = false;
+    }
+    else {
+      usedIds |= (1UL << p.id);
+    }
+  }
+
+  if (!tracked) { // Fall back to the slot index
+    for (uint8_t i = 0; i < frame.count; i++) {
+      frame.points [i].id = i;
+    }
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Reads the touch panel into the touch frame of the UI.
+ * 
+ * @return true The panel is being touched.
+ * @return false The panel is not touched.
+ */
+bool CSE_UI:: readTouch() {
+  bool touched = sampleTouch (touchFrame);
+  updateTouchOwners();
+  return touched;
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the touch snapshot the widgets should hit-test against. Inside a frame
+ * (between beginFrame() and endFrame()) the same snapshot is returned to every widget.
+ * Outside a frame, the panel is read at most once every CSEUI_TOUCH_SAMPLE_PERIOD
+ * microseconds, and the widgets that ask in between share the last snapshot. This keeps
+ * the touch filter running once per sample instead of once per widget.
+ * 
+ * @return const CSE_UI_TouchFrame& 
+ */
+const CSE_UI_TouchFrame& CSE_UI:: getTouchFrame() {
+  if (!frameActive) {
+    uint32_t now = micros();
+
+    if ((!touchSampleValid) || ((now - touchSampleTime) >= CSEUI_TOUCH_SAMPLE_PERIOD)) {
+      readTouch();
+      touchSampleTime = now;
+      touchSampleValid = true;
+    }
+  }
+  return touchFrame;
+}
+
+//============================================================================================//
+/**
+ * @brief Sets a recorder that receives every raw touch frame. Set NULL to detach.
+ * 
+ * @param recorder 
+ */
+void CSE_UI:: setTouchRecorder (touchRecorderClass* recorder) {
+  touchRecorder = recorder;
+}
+
+//============================================================================================//
+/**
+ * @brief Sets a replay that is read instead of the touch panel. Set NULL to go back to
+ * the panel.
+ * 
+ * @param replay 
+ */
+void CSE_UI:: setTouchReplay (touchReplayClass* replay) {
+  touchReplay = replay;
+  touchFilter.reset();
+  gesture.reset();
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the icon atlas used by the buttons to draw their icons. Pass NULL to draw
+ * the icons directly again.
+ * 
+ * @param atlas The atlas. It must be started with begin().
+ */
+void CSE_UI:: setIconAtlas (iconAtlasClass* atlas) {
+  iconAtlas = atlas;
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the point with the given ID from the current touch frame.
+ * 
+ * @param id The touch point ID.
+ * @return const CSE_UI_TouchPoint* The point, or NULL if the ID is not active.
+ */
+const CSE_UI_TouchPoint* CSE_UI:: findTouchPoint (uint8_t id) {
+  for (int i = 0; i < touchFrame.count; i++) {
+    if (touchFrame.points [i].id == id) {
+      return &touchFrame.points [i];
+    }
+  }
+  return NULL;
+}
+
+//============================================================================================//
+/**
+ * @brief Assigns a touch point to a widget. A point can only be held by one widget at a
+ * time, so each finger is routed to exactly one widget and several widgets can be held
+ * at once with different fingers. While a dialog is open, only its buttons get points.
+ * 
+ * @param id The touch point ID.
+ * @param widget The widget that wants the point.
+ * @return true The point now belongs to the widget.
+ * @return false The point is held by another widget.
+ */
+bool CSE_UI:: claimTouch (uint8_t id, void* widget) {
+  if (id >= CSEUI_TOUCH_MAX_POINTS) {
+    return false;
+  }
+  if ((touchOwner [id] != NULL) && (touchOwner [id] != widget)) {
+    return false;
+  }
+  if ((modalDialog != NULL) && (!modalDialog->ownsWidget (widget))) {
+    return false;
+  }
+  touchOwner [id] = widget;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Releases a touch point held by a widget.
+ * 
+ * @param id The touch point ID.
+ * @param widget The widget holding the point.
+ */
+void CSE_UI:: releaseTouch (uint8_t id, void* widget) {
+  if ((id < CSEUI_TOUCH_MAX_POINTS) && (touchOwner [id] == widget)) {
+    touchOwner [id] = NULL;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Frees the touch points that are no longer on the panel, so that a new finger
+ * with the same ID can be claimed by another widget.
+ * 
+ */
+void CSE_UI:: updateTouchOwners() {
+  for (int i = 0; i < CSEUI_TOUCH_MAX_POINTS; i++) {
+    if ((touchOwner [i] != NULL) && (findTouchPoint (i) == NULL)) {
+      touchOwner [i] = NULL;
+    }
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Starts a new frame. The touch snapshot is taken from the input queue when the
+ * tasks are running, or read from the panel otherwise. Draw your widgets after this
+ * and call endFrame() when done.
+ * 
+ */
+void CSE_UI:: beginFrame() {
+  startFrame (tasksRunning);
+}
+
+//============================================================================================//
+/**
+ * @brief Starts a frame with the touch snapshot from the input queue, or from the panel.
+ * The render task always takes the queue, even while endTasks() is stopping it, since the
+ * input task may still be reading the panel.
+ * 
+ * @param queued true to take the snapshot from the input queue.
+ */
+void CSE_UI:: startFrame (bool queued) {
+  CSE_UI_TouchFrame prev = touchFrame;
+
+  if (queued) {
+    CSE_UI_TouchFrame frame;
+    touchChanged = inputQueue.pop (frame); // The input task only queues frames that changed
+
+    if (touchChanged) { // Keep the previous snapshot if nothing new arrived
+      touchFrame = frame;
+      updateTouchOwners();
+    }
+  }
+  else {
+    readTouch();
+    touchChanged = (touchFrame.count != prev.count);
+
+    for (int i = 0; (!touchChanged) && (i < touchFrame.count); i++) {
+      touchChanged = (touchFrame.points [i].x != prev.points [i].x) || (touchFrame.points [i].y != prev.points [i].y);
+    }
+
+    if (gestureEnabled) { // The input task does this when it is running
+      CSE_UI_Gesture g;
+      if (gesture.update (touchFrame, g)) {
+        queueGesture (g);
+      }
+    }
+  }
+  if (touchChanged) {
+    prevTouchFrame = prev;
+  }
+  frameActive = true;
+
+#if defined(CSEUI_ENABLE_PROFILER)
+  profiler.beginFrame();
+#endif
+#if defined(CSEUI_ENABLE_ALLOC_TRACKING)
+  allocTracker.beginFrame();
+#endif
+}
+
+//============================================================================================//
+/**
+ * @brief Ends the current frame.
+ * 
+ */
+void CSE_UI:: endFrame() {
+  frameActive = false;
+  touchChanged = false;
+
+#if defined(CSEUI_ENABLE_PROFILER)
+  profiler.endFrame();
+#endif
+#if defined(CSEUI_ENABLE_ALLOC_TRACKING)
+  allocTracker.endFrame();
+#endif
+}
+
+//============================================================================================//
+/**
+ * @brief Redirects the drawing of all widgets to another TFT_eSPI object, such as a
+ * sprite. Returns the previous target so that it can be restored.
+ * 
+ * @param target The new draw target.
+ * @return TFT_eSPI* The previous draw target.
+ */
+TFT_eSPI* CSE_UI:: setDrawTarget (TFT_eSPI* target) {
+  TFT_eSPI* prev = lcdParent;
+  lcdParent = target;
+  return prev;
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the screen position that the top-left of the draw target shows, for
+ * drawing a part of the screen into a smaller sprite. Widgets keep using their screen
+ * coordinates. Set it back to (0, 0) before drawing to the LCD again.
+ * 
+ * @param x Screen X-coordinate of the top-left of the target.
+ * @param y Screen Y-coordinate of the top-left of the target.
+ */
+void CSE_UI:: setOrigin (int16_t x, int16_t y) {
+  originX = x;
+  originY = y;
+  resetViewport();
+}
+
+//============================================================================================//
+/**
+ * @brief Sets a viewport on the draw target in screen coordinates. Widgets use this
+ * instead of calling the LCD directly, so that they are placed correctly when drawn with
+ * an origin.
+ * 
+ * A clip-only viewport (datum = false) can not be combined with an origin, so only the
+ * origin is applied then, without clipping.
+ * 
+ * If a clip rectangle is set, the viewport is cut down to it. A viewport with datum = true
+ * can only be cut on the right and bottom, since its top-left is the drawing origin; if it
+ * would have to be cut on the other sides, it is used as is and clipExact is cleared.
+ * 
+ * @param x X-coordinate of the viewport.
+ * @param y Y-coordinate of the viewport.
+ * @param w Width of the viewport.
+ * @param h Height of the viewport.
+ * @param datum true to draw relative to the viewport, false to only clip.
+ */
+void CSE_UI:: setViewport (int32_t x, int32_t y, int32_t w, int32_t h, bool datum) {
+  if (clipActive) {
+    int32_t left = (x > clipX) ? x : clipX;
+    int32_t top = (y > clipY) ? y : clipY;
+    int32_t right = ((x + w) < (clipX + clipWidth)) ? (x + w) : (clipX + clipWidth);
+    int32_t bottom = ((y + h) < (clipY + clipHeight)) ? (y + h) : (clipY + clipHeight);
+
+    if (right < left) right = left;
+    if (bottom < top) bottom = top;
+
+    if ((!datum) || ((left == x) && (top == y))) {
+      x = left;
+      y = top;
+      w = right - left;
+      h = bottom - top;
+    }
+    else {
+      clipExact = false;  // Moving the top-left would move the datum
+    }
+  }
+
+  if (datum || ((originX == 0) && (originY == 0))) {
+    lcdParent->setViewport (x - originX, y - originY, w, h, datum);
+  }
+  else {
+    resetViewport();
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Removes the viewport set with setViewport(). With an origin, screen coordinates
+ * stay shifted into the draw target. Otherwise, drawing stays clipped to the clip
+ * rectangle, if one is set.
+ * 
+ */
+void CSE_UI:: resetViewport() {
+  lcdParent->resetViewport();
+
+  if ((originX != 0) || (originY != 0)) {
+    lcdParent->setViewport (-originX, -originY, lcdParent->width() + originX, lcdParent->height() + originY, true);
+
+    if (clipActive) {
+      clipExact = false;
+    }
+  }
+  else if (clipActive) {
+    lcdParent->setViewport (clipX, clipY, clipWidth, clipHeight, false);
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Returns a value that changes when the font of the draw target changes. TFT_eSPI
+ * does not expose the free font in use, so the font is told apart by its metrics: the
+ * height and the widths of a few glyphs. The text size scales all of them.
+ * 
+ * @return uint32_t 
+ */
+uint32_t CSE_UI:: getFontId() {
+  uint32_t id = (uint16_t) lcdParent->fontHeight();
+
+  id = (id * 31) + (uint16_t) lcdParent->textWidth ("M");
+  id = (id * 31) + (uint16_t) lcdParent->textWidth ("i");
+  id = (id * 31) + (uint16_t) lcdParent->textWidth ("0");
+  return id;
+}
+
+//============================================================================================//
+/**
+ * @brief Clips everything the UI draws to a rectangle, until clearClip(). Used to redraw
+ * only the part of a widget that is not covered by the widgets above it.
+ * 
+ * @param x X-coordinate of the rectangle.
+ * @param y Y-coordinate of the rectangle.
+ * @param w Width of the rectangle.
+ * @param h Height of the rectangle.
+ */
+void CSE_UI:: setClip (int16_t x, int16_t y, int16_t w, int16_t h) {
+  clipX = x;
+  clipY = y;
+  clipWidth = w;
+  clipHeight = h;
+  clipActive = true;
+  clipExact = true;
+  resetViewport();
+}
+
+//============================================================================================//
+
+void CSE_UI:: clearClip() {
+  clipActive = false;
+  resetViewport();
+}
+
+//============================================================================================//
+/**
+ * @brief Enables the gesture recogniser. Gestures are decoded on the input side and can
+ * be read on the render side with getGesture().
+ * 
+ */
+void CSE_UI:: enableGestures() {
+  gesture.reset();
+  gestureQueue.clear();
+  gestureEnabled = true;
+}
+
+//============================================================================================//
+
+void CSE_UI:: disableGestures() {
+  gestureEnabled = false;
+}
+
+//============================================================================================//
+/**
+ * @brief Takes the oldest recognised gesture from the queue. Call this from the render
+ * side until it returns false, and pass the gestures to the widgets. While a dialog is
+ * open, the gestures are dropped so the widgets under it do not move.
+ * 
+ * @param g The gesture.
+ * @return true A gesture was returned.
+ * @return false No gestures are pending.
+ */
+bool CSE_UI:: getGesture (CSE_UI_Gesture& g) {
+  if (modalDialog != NULL) {
+    while (gestureQueue.pop (g));
+    return false;
+  }
+  return gestureQueue.pop (g);
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the function that receives widget events. When the tasks are running, the
+ * function is called from the input task.
+ * 
+ * @param func 
+ */
+void CSE_UI:: setEventHandler (eventFuncPtr func) {
+  eventHandler = func;
+}
+
+//============================================================================================//
+/**
+ * @brief Queues a widget event. Events are dropped if no handler is set or if the queue
+ * is full.
+ * 
+ * @param type One of the CSEUI_EVENT_* values.
+ * @param widget The widget that generated the event.
+ * @param x X-coordinate of the touch.
+ * @param y Y-coordinate of the touch.
+ */
+void CSE_UI:: postEvent (uint8_t type, void* widget, int16_t x, int16_t y) {
+  if (eventHandler == NULL) {
+    return;
+  }
+
+  CSE_UI_Event event;
+  event.type = type;
+  event.widget = widget;
+  event.x = x;
+  event.y = y;
+  event.timestamp = micros();
+  eventQueue.push (event);
+}
+
+//============================================================================================//
+/**
+ * @brief Sends all queued events to the event handler. The input task calls this
+ * automatically. Call it from the loop if you are not using the tasks.
+ * 
+ */
+void CSE_UI:: dispatchEvents() {
+  CSE_UI_Event event;
+
+  while (eventQueue.pop (event)) {
+    if (eventHandler != NULL) {
+      eventHandler (event);
+    }
+  }
+}
+
+//============================================================================================//
+
+static bool mergeDrag (CSE_UI_Gesture& last, const CSE_UI_Gesture& g) {
+  if ((last.type != CSEUI_GESTURE_DRAG) || (g.type != CSEUI_GESTURE_DRAG)) return false;
+
+  last.x = g.x;
+  last.y = g.y;
+  last.dx += g.dx;
+  last.dy += g.dy;
+  last.velocityX = g.velocityX;
+  last.velocityY = g.velocityY;
+  last.timestamp = g.timestamp;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Adds a gesture to the gesture queue. A drag that follows a drag still waiting in
+ * the queue is added to it, so no movement is lost when the render side falls behind.
+ * 
+ * @param g The gesture.
+ */
+void CSE_UI:: queueGesture (const CSE_UI_Gesture& g) {
+  gestureQueue.pushMerge (g, mergeDrag);
+}
+
+//============================================================================================//
+
+static bool isPageEvent (const CSE_UI_Event& event, void* page) {
+  return ((pageClass*) page)->ownsWidget (event.widget);
+}
+
+//============================================================================================//
+/**
+ * @brief Drops the queued events, frees the touch points and clears the focus of the
+ * widgets of a page. Called by pageClass:: release() before the widgets are destroyed.
+ * 
+ * @param page The page.
+ */
+void CSE_UI:: forgetPage (pageClass* page) {
+  eventQueue.removeIf (isPageEvent, page);
+
+  if ((focusWidget != NULL) && page->ownsWidget (focusWidget)) {
+    focusWidget = NULL;
+  }
+
+  for (int i = 0; i < CSEUI_TOUCH_MAX_POINTS; i++) {
+    if ((touchOwner [i] != NULL) && page->ownsWidget (touchOwner [i])) {
+      touchOwner [i] = NULL;
+    }
+  }
+}
+
+//============================================================================================//
+
+widgetClass:: widgetClass() {
+  nextWidget = NULL;
+  widgetType = CSEUI_WIDGET_NONE;
+  widgetId = 0;
+  drawPriority = 0;
+  drawAge = 0;
+  drawTime = 0;
+  zOrder = 0;
+  opaque = false;
+  latencyPending = false;
+  latencyStart = 0;
 }
 
 //============================================================================================//
@@ -29,6 +661,19 @@ CSE_UI:: CSE_UI (TFT_eSPI* lcd, CSE_Touch* ts) {
 pageClass:: pageClass (CSE_UI* ui, int page) {
   uiParent = ui;
   pageNum = page;
+  pageActive = false;
+  drawFunction = NULL;
+  initFunction = NULL;
+  bgDrawn = false;
+  firstWidget = NULL;
+  lastWidget = NULL;
+  widgetCount = 0;
+  bgColor = -1;
+  arenaSize = 0;
+  screen = NULL;
+  initialized = false;
+  nextPage = NULL;
+  lastUsed = 0;
 }
 
 //============================================================================================//
@@ -45,24 +690,101 @@ void pageClass:: setDrawFunction (funcPtr func) {
 
 //============================================================================================//
 
+/**
+ * @brief Sets the screen file to load the widgets of the page from when it is initialized.
+ * The page number selects the page in the file.
+ * 
+ * @param loader A screen loader that was started with begin().
+ */
+void pageClass:: setScreen (screenLoaderClass* loader) {
+  screen = loader;
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the size of the page arena. The arena is allocated on the next init() and
+ * kept when the page is left, so entering the page again does not allocate. If a screen
+ * file is set and no size is given, the arena is sized for the screen file.
+ * 
+ * @param size Size of the arena in bytes.
+ */
+void pageClass:: setArenaSize (size_t size) {
+  evict();
+  arenaSize = size;
+}
+
+//============================================================================================//
+/**
+ * @brief Initializes the page: loads the widgets from the screen file, if set, and calls
+ * the init function.
+ * 
+ * @return true The widgets were loaded or the init function was called.
+ * @return false There was nothing to do or the screen file could not be loaded.
+ */
 bool pageClass:: init() {
+  bool done = false;
+
+  initialized = true;
+
+  if ((arena.capacity == 0) && (getArenaSize() > 0)) {
+    arena.begin (getArenaSize());
+  }
+
+  if (screen != NULL) {
+    done = screen->loadPage (this, &arena);
+  }
+
   if (initFunction != NULL) {
     initFunction();
-    return true;
+    done = true;
   }
-  return false;
+  return done;
 }
 
 //============================================================================================//
 
+/**
+ * @brief Draws the page if it is active. The background is filled on the first draw after
+ * the page was activated. Then the draw function is called, and the widgets of the page
+ * are drawn in the order they were added.
+ * 
+ * @return true The page is active.
+ * @return false The page is not active.
+ */
 bool pageClass:: draw() {
   if (pageActive) {
-    drawFunction();
+    drawBackground();
+
+    for (widgetClass* w = firstWidget; w != NULL; w = w->nextWidget) {
+      drawWidget (w);
+    }
+
+    if (uiParent->modalDialog != NULL) {
+      uiParent->modalDialog->draw();
+    }
     return true;
   }
   return false;
 }
 
+//============================================================================================//
+/**
+ * @brief Fills the background if it was not drawn yet and calls the draw function. This
+ * is the part of draw() that comes before the widgets. The draw function is not called
+ * while a dialog is open, since it could draw over the dialog.
+ * 
+ */
+void pageClass:: drawBackground() {
+  if ((bgColor >= 0) && (!bgDrawn)) {
+    uiParent->lcdParent->fillScreen ((uint16_t) bgColor);
+    bgDrawn = true;
+  }
+
+  if ((drawFunction != NULL) && (uiParent->modalDialog == NULL)) {
+    drawFunction();
+  }
+}
+
 //============================================================================================//
 
 bool pageClass:: isActive() {
@@ -72,6 +794,10 @@ bool pageClass:: isActive() {
 //============================================================================================//
 
 bool pageClass:: setActive() {
+  if (!pageActive) {
+    bgDrawn = false;
+    invalidate(); // The screen is drawn over, so every widget is drawn again
+  }
   pageActive = true;
   return pageActive;
 }
@@ -84,3 +810,194 @@ bool pageClass:: setInactive() {
 }
 
 //============================================================================================//
+/**
+ * @brief Draws the whole page whether it is active or not: fills the background, calls
+ * the draw function and draws every widget. Used to render pages off-screen, such as in
+ * transitions.
+ * 
+ */
+void pageClass:: redraw() {
+  if (bgColor >= 0) {
+    uiParent->lcdParent->fillScreen ((uint16_t) bgColor);
+  }
+  bgDrawn = true;
+  invalidate();
+
+  if (drawFunction != NULL) {
+    drawFunction();
+  }
+
+  for (widgetClass* w = firstWidget; w != NULL; w = w->nextWidget) {
+    w->draw();
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Initializes the page if needed and activates it.
+ * 
+ * @return true Always.
+ */
+bool pageClass:: enter() {
+  if (!initialized) {
+    init();
+  }
+  return setActive();
+}
+
+//============================================================================================//
+/**
+ * @brief Deactivates the page and releases its widgets. The page is initialized again on
+ * the next enter().
+ * 
+ */
+void pageClass:: leave() {
+  setInactive();
+  release();
+}
+
+//============================================================================================//
+/**
+ * @brief Destroys the widgets in the page arena and frees the arena at once. Widgets
+ * added with addWidget() that are not in the arena are only removed from the page. The
+ * queued events and the touch points of the widgets are dropped first, so no event or
+ * touch refers to a destroyed widget. Call it from the render task, or while holding
+ * lockState(); an event that the input task is already handling is not affected.
+ * 
+ */
+void pageClass:: release() {
+  uiParent->forgetPage (this);
+  clearWidgets();
+  arena.reset();
+  initialized = false;
+}
+
+//============================================================================================//
+/**
+ * @brief Releases the widgets like release(), and also frees the arena buffer. The buffer
+ * is allocated again on the next init().
+ * 
+ */
+void pageClass:: evict() {
+  release();
+  arena.end();
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the RAM held by the page arena.
+ * 
+ * @return size_t Bytes.
+ */
+size_t pageClass:: getMemory() {
+  return arena.capacity;
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the size of the arena that init() allocates: the size given to
+ * setArenaSize(), or else the size the screen file needs for the page.
+ * 
+ * @return size_t Bytes, or 0 if the page has no arena.
+ */
+size_t pageClass:: getArenaSize() {
+  if (arenaSize > 0) return arenaSize;
+  if (screen != NULL) return screen->getArenaSize (pageNum);
+  return 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Adds a widget to the page, above the widgets with the same or a lower zOrder.
+ * Widgets are drawn from the bottom up, so widgets with the same zOrder are drawn in the
+ * order they were added. A widget can only be in one page.
+ * 
+ * @param widget The widget.
+ */
+void pageClass:: addWidget (widgetClass* widget) {
+  widget->nextWidget = NULL;
+
+  if (lastWidget == NULL) {
+    firstWidget = widget;
+    lastWidget = widget;
+  }
+  else if (lastWidget->zOrder <= widget->zOrder) {
+    lastWidget->nextWidget = widget;
+    lastWidget = widget;
+  }
+  else { // Goes below a widget that is already on the page
+    widgetClass* prev = NULL;
+    widgetClass* w = firstWidget;
+
+    while (w->zOrder <= widget->zOrder) {
+      prev = w;
+      w = w->nextWidget;
+    }
+
+    widget->nextWidget = w;
+
+    if (prev == NULL) {
+      firstWidget = widget;
+    }
+    else {
+      prev->nextWidget = widget;
+    }
+  }
+  widgetCount++;
+}
+
+//============================================================================================//
+/**
+ * @brief Finds a widget by the ID given in the screen file.
+ * 
+ * @param id The widget ID.
+ * @return widgetClass* The widget, or NULL if the page has no widget with the ID.
+ */
+widgetClass* pageClass:: findWidget (uint16_t id) {
+  for (widgetClass* w = firstWidget; w != NULL; w = w->nextWidget) {
+    if (w->widgetId == id) return w;
+  }
+  return NULL;
+}
+
+//============================================================================================//
+/**
+ * @brief Checks if a widget belongs to the page: it was added to the page, or it lies in
+ * the page arena, like the items of a list loaded from a screen file.
+ * 
+ * @param widget The widget.
+ * @return true 
+ * @return false 
+ */
+bool pageClass:: ownsWidget (const void* widget) {
+  if (arena.contains (widget)) return true;
+
+  for (widgetClass* w = firstWidget; w != NULL; w = w->nextWidget) {
+    if (w == widget) return true;
+  }
+  return false;
+}
+
+//============================================================================================//
+/**
+ * @brief Removes all widgets from the page. The widgets are not destroyed.
+ * 
+ */
+void pageClass:: clearWidgets() {
+  firstWidget = NULL;
+  lastWidget = NULL;
+  widgetCount = 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Marks all widgets of the page for a full redraw.
+ * 
+ */
+void pageClass:: invalidate() {
+  for (widgetClass* w = firstWidget; w != NULL; w = w->nextWidget) {
+    w->invalidate();
+  }
+}
+
+//============================================================================================//
@@ -9,7 +9,7 @@
   Version: 0.0.8
   License: MIT
   Source: https://github.com/CIRCUITSTATE/CSE_CST328
-  Last Modified: +05:30 22:15:39 PM 06-05-2025, Tuesday
+  Last Modified: +05:30 08:31:57 AM 21-10-2026, Wednesday
  */
 //============================================================================================//
 
@@ -23,8 +23,29 @@
 
 #if defined(ARDUINO_ARCH_AVR)
   #include <ArduinoSTL.h>
+  #include <new>
 #else
   #include <vector>
+  #include <utility>
+  #include <new>
+  #include <atomic>
+#endif
+
+// The render/input split uses FreeRTOS tasks on ESP32 and std::thread on the host build.
+// Other targets run everything from the loop as before.
+#if defined(ARDUINO_ARCH_ESP32)
+  #include <freertos/FreeRTOS.h>
+  #include <freertos/task.h>
+  #include <freertos/semphr.h>
+  #include <FS.h>
+  #include <esp_partition.h>
+  #include <esp_heap_caps.h>
+#elif !defined(ARDUINO)
+  #define CSEUI_HOST_BUILD
+  #include <thread>
+  #include <mutex>
+  #include <chrono>
+  #include <stdio.h>
 #endif
 
 //============================================================================================//
@@ -48,10 +69,776 @@
 #define   CSEUI_BUTTON_ALIGN_MC                     5   // Middle Center
 
 #define   CSEUI_TOUCH_PRESSURE_THRESHOLD            0
+#define   CSEUI_TOUCH_MAX_POINTS                    5   // Maximum touch points held in a frame
+#define   CSEUI_TOUCH_SAMPLE_PERIOD                 5000  // Min. time in us between panel reads outside a frame
+
+// Touch filter settings
+#define   CSEUI_FILTER_NONE                         0   // Raw coordinates
+#define   CSEUI_FILTER_MEDIAN                       1   // Median of the last 3 samples
+#define   CSEUI_FILTER_EMA                          2   // Exponential moving average
+#define   CSEUI_FILTER_DEF_EMA_WEIGHT               96  // Weight of a new sample, out of 256
+
+// Render/input split settings
+#define   CSEUI_INPUT_QUEUE_LENGTH                  4   // Touch frames waiting to be rendered
+#define   CSEUI_EVENT_QUEUE_LENGTH                  8   // Widget events waiting to be dispatched
+#define   CSEUI_INPUT_TASK_STACK                    4096
+#define   CSEUI_RENDER_TASK_STACK                   8192
+#define   CSEUI_INPUT_PERIOD_MS                     10  // Touch sampling period of the input task
+
+// Widget event types
+#define   CSEUI_EVENT_NONE                          0
+#define   CSEUI_EVENT_TOUCH                         1   // A widget started being touched
+#define   CSEUI_EVENT_PRESS                         2   // A widget was touched and released
+#define   CSEUI_EVENT_CANCEL                        3   // A touch slid off a widget before the release
+
+// Gesture types
+#define   CSEUI_GESTURE_NONE                        0
+#define   CSEUI_GESTURE_TAP                         1   // Short touch without movement
+#define   CSEUI_GESTURE_LONG_PRESS                  2   // Long touch without movement
+#define   CSEUI_GESTURE_DRAG                        3   // Touch moved; reported on every move
+#define   CSEUI_GESTURE_FLICK                       4   // Drag released with enough velocity
+#define   CSEUI_GESTURE_RELEASE                     5   // Drag released without a flick
+
+#define   CSEUI_GESTURE_QUEUE_LENGTH                8   // Gestures waiting to be consumed
+#define   CSEUI_GESTURE_TAP_SLOP                    8   // Max. movement in pixels for a tap
+#define   CSEUI_GESTURE_LONG_PRESS_MS               600 // Min. hold time for a long press
+#define   CSEUI_GESTURE_FLICK_VELOCITY              300 // Min. release velocity for a flick in px/s
+#define   CSEUI_GESTURE_FLICK_TIMEOUT_MS            100 // A drag that rested longer than this is not a flick
+
+// Touch trace format
+#define   CSEUI_TRACE_VERSION                       1
+#define   CSEUI_TRACE_HEADER_SIZE                   6   // "CSTT", version, max. points
+
+// Latency statistics
+#define   CSEUI_LATENCY_BUCKETS                     64  // Histogram buckets of 1 ms each; the last one collects the rest
+
+// Draw profiler. Define CSEUI_ENABLE_PROFILER in the build flags to compile it in.
+#define   CSEUI_PROFILER_MAX_WIDGETS                32  // Widget instances that can be tracked
+
+// Allocation tracker. Define CSEUI_ENABLE_ALLOC_TRACKING in the build flags to compile it in.
+#define   CSEUI_ALLOC_MAX_WIDGETS                   32  // Widget instances that can be tracked
+
+#define   CSEUI_LIST_SCROLL_FRICTION                2000  // Deceleration of a flicked list in px/s^2
+
+// Byte sources and text viewer
+#define   CSEUI_SOURCE_CHUNK_SIZE                   64  // Bytes read from a source at once
+#define   CSEUI_VIEWER_INDEX_STEP                   16  // Lines between two entries of the line index
+#define   CSEUI_VIEWER_LINE_MAX                     160 // Bytes of a line that are drawn; the rest is cut
+
+// Image formats
+#define   CSEUI_IMAGE_RGB565                        0   // Raw RGB565 pixels, little-endian
+#define   CSEUI_IMAGE_RLE                           1   // Run-length encoded RGB565 pixels
+#define   CSEUI_IMAGE_PALETTE                       2   // 8-bit indices into an RGB565 palette
+#define   CSEUI_IMAGE_HEADER_SIZE                   10  // "CSI", format, width, height, palette entries
+#define   CSEUI_IMAGE_DEF_STRIP_HEIGHT              8   // Rows decoded and pushed at once
+
+// Span-encoded icons
+#define   CSEUI_ICON_SPAN_MARKER                    0xC5  // First byte of a span-encoded icon
+#define   CSEUI_ICON_SPAN_HEADER_SIZE               8   // Marker, cell size, glyph bounds, reserved
+
+// Alpha icons
+#define   CSEUI_ICON_ALPHA_MARKER                   0xA4  // First byte of a 4-bit alpha icon
+#define   CSEUI_ICON_ALPHA_HEADER_SIZE              8   // Same layout as the span header
+#define   CSEUI_ICON_MAX_WIDTH                      255 // Widest glyph; the headers store it in a byte
+
+// Widget types, as stored in screen files
+#define   CSEUI_WIDGET_NONE                         0
+#define   CSEUI_WIDGET_BUTTON                       1
+#define   CSEUI_WIDGET_LIST                         2
+#define   CSEUI_WIDGET_TEXTAREA                     3
+#define   CSEUI_WIDGET_STRING                       4
+#define   CSEUI_WIDGET_PAGINATION                   5
+#define   CSEUI_WIDGET_VIEWER                       6   // Created in code only
+#define   CSEUI_WIDGET_IMAGE                        7   // Created in code only
+#define   CSEUI_WIDGET_DIALOG                       8   // Created in code only
+
+// Screen files
+#define   CSEUI_SCREEN_VERSION                      1
+#define   CSEUI_SCREEN_HEADER_SIZE                  8   // "CSU", version, page count, style count, string count
+#define   CSEUI_SCREEN_PAGE_SIZE                    12  // Size of a page directory entry
+#define   CSEUI_SCREEN_STYLE_SIZE                   8   // Four RGB565 colors
+#define   CSEUI_SCREEN_WIDGET_SIZE                  18  // Size of a widget record without its extra values
+#define   CSEUI_SCREEN_NO_TEXT                      0xFFFF  // Text ID of widgets without a text
+#define   CSEUI_SCREEN_DEFAULT_STYLE                0xFF  // Style index of widgets with the default style
+#define   CSEUI_SCREEN_HIDDEN                       0x01  // Widget flags
+#define   CSEUI_SCREEN_BORDER                       0x02
+#define   CSEUI_SCREEN_NO_FILL                      0x04
+#define   CSEUI_SCREEN_DISABLED                     0x08
+#define   CSEUI_SCREEN_PAGE_FILL                    0x01  // Page flags
+
+#define   CSEUI_ARENA_ALIGN                         8   // Alignment of arena allocations
+#define   CSEUI_PAGE_DEF_BUDGET                     0   // Bytes of page arenas kept in RAM; 0 for no limit
+#define   CSEUI_TICK_DEF_BUDGET                     4000  // Microseconds of drawing per tick()
+#define   CSEUI_TICK_DONE                           0xFF  // drawAge of a widget drawn in the current tick
+#define   CSEUI_TICK_MAX_WAIT                       8   // Ticks a widget waits before it is drawn regardless of the budget
+#define   CSEUI_CLIP_MAX_RECTS                      8   // Pieces of a widget left uncovered before it is drawn whole
+
+// Dialogs
+#define   CSEUI_DIALOG_NONE                         0   // Results of dialogClass:: getResult()
+#define   CSEUI_DIALOG_OK                           1
+#define   CSEUI_DIALOG_CANCEL                       2
+#define   CSEUI_DIALOG_MARGIN                       8   // Pixels between the frame and the contents
+#define   CSEUI_DIALOG_BUTTON_HEIGHT                30
+#define   CSEUI_DIALOG_DEF_BORDER_COLOR             TFT_WHITE
+
+// The region under a dialog is saved with readRect() only if the LCD can be read back.
+// Define this as 0 or 1 to override the guess made from the TFT_eSPI setup.
+#if !defined(CSEUI_LCD_READABLE)
+  #if defined(CSEUI_HOST_BUILD) || defined(TFT_SDA_READ) || defined(TFT_PARALLEL_8_BIT) || defined(TFT_PARALLEL_16_BIT) || (defined(TFT_MISO) && (TFT_MISO >= 0))
+    #define   CSEUI_LCD_READABLE                    1
+  #else
+    #define   CSEUI_LCD_READABLE                    0
+  #endif
+#endif
+
+// Page transitions
+#define   CSEUI_TRANSITION_NONE                     0
+#define   CSEUI_TRANSITION_SLIDE_LEFT               1   // The new page slides in over the old one, moving left
+#define   CSEUI_TRANSITION_SLIDE_RIGHT              2
+#define   CSEUI_TRANSITION_SLIDE_UP                 3
+#define   CSEUI_TRANSITION_SLIDE_DOWN               4
+#define   CSEUI_TRANSITION_PUSH_LEFT                5   // The new page pushes the old one out, moving left
+#define   CSEUI_TRANSITION_PUSH_RIGHT               6
+#define   CSEUI_TRANSITION_PUSH_UP                  7
+#define   CSEUI_TRANSITION_PUSH_DOWN                8
+#define   CSEUI_TRANSITION_FADE                     9   // Cross-fade
+#define   CSEUI_TRANSITION_DEF_DURATION             300 // Milliseconds
+#define   CSEUI_TRANSITION_DEF_FPS                  30
+#define   CSEUI_TRANSITION_DEF_STRIP_HEIGHT         16  // Rows composed and pushed at once
+
+//============================================================================================//
+/**
+ * @brief A recursive mutex used to guard state shared between the input and render
+ * tasks. On targets without an RTOS, locking is a no-op.
+ * 
+ */
+class CSE_UI_Mutex {
+  private:
+  #if defined(ARDUINO_ARCH_ESP32)
+    SemaphoreHandle_t handle;
+  #elif defined(CSEUI_HOST_BUILD)
+    std::recursive_mutex handle;
+  #endif
+  public:
+    CSE_UI_Mutex();
+    ~CSE_UI_Mutex();
+    void lock();
+    void unlock();
+};
+
+//============================================================================================//
+/**
+ * @brief A bounded FIFO queue used to pass work between the input and render tasks.
+ * The storage is allocated statically, so pushing never allocates memory.
+ * 
+ * @tparam T Type of the items.
+ * @tparam N Maximum number of items the queue can hold.
+ */
+template <typename T, int N>
+class CSE_UI_Queue {
+  private:
+    T items [N];
+    int head; // Index of the oldest item
+    int count;  // Number of items in the queue
+    CSE_UI_Mutex mutex;
+  public:
+    CSE_UI_Queue() : head (0), count (0) {}
+
+    // Adds an item to the end of the queue. Returns false if the queue is full.
+    bool push (const T& item) {
+      mutex.lock();
+      if (count >= N) {
+        mutex.unlock();
+        return false;
+      }
+      items [(head + count) % N] = item;
+      count++;
+      mutex.unlock();
+      return true;
+    }
+
+    // Adds an item to the end of the queue, dropping the oldest item if the queue is full.
+    void pushOverwrite (const T& item) {
+      mutex.lock();
+      if (count >= N) {
+        head = (head + 1) % N;
+        count--;
+      }
+      items [(head + count) % N] = item;
+      count++;
+      mutex.unlock();
+    }
+
+    // Lets merge() fold the item into the newest item in the queue. If it returns false or
+    // the queue is empty, the item is added with pushOverwrite().
+    void pushMerge (const T& item, bool (*merge)(T& last, const T& item)) {
+      mutex.lock();
+      if ((count > 0) && merge (items [(head + count - 1) % N], item)) {
+        mutex.unlock();
+        return;
+      }
+      if (count >= N) {
+        head = (head + 1) % N;
+        count--;
+      }
+      items [(head + count) % N] = item;
+      count++;
+      mutex.unlock();
+    }
+
+    // Removes the oldest item from the queue. Returns false if the queue is empty.
+    bool pop (T& item) {
+      mutex.lock();
+      if (count == 0) {
+        mutex.unlock();
+        return false;
+      }
+      item = items [head];
+      head = (head + 1) % N;
+      count--;
+      mutex.unlock();
+      return true;
+    }
+
+    int available() {
+      mutex.lock();
+      int n = count;
+      mutex.unlock();
+      return n;
+    }
+
+    // Removes the items for which match() returns true, keeping the others in order.
+    // Returns the number of items removed.
+    int removeIf (bool (*match)(const T& item, void* arg), void* arg) {
+      mutex.lock();
+      int kept = 0;
+      for (int i = 0; i < count; i++) {
+        const T& item = items [(head + i) % N];
+        if (!match (item, arg)) {
+          items [(head + kept) % N] = item;
+          kept++;
+        }
+      }
+      int removed = count - kept;
+      count = kept;
+      mutex.unlock();
+      return removed;
+    }
+
+    void clear() {
+      mutex.lock();
+      head = 0;
+      count = 0;
+      mutex.unlock();
+    }
+};
+
+//============================================================================================//
+/**
+ * @brief A single touch point inside a touch frame.
+ * 
+ */
+struct CSE_UI_TouchPoint {
+  int16_t x;
+  int16_t y;
+  int16_t z;  // Pressure
+  uint8_t id; // Contact ID reported by the panel
+};
+
+/**
+ * @brief A snapshot of the touch panel taken once per frame. Widgets hit-test against
+ * the snapshot instead of reading the panel themselves.
+ * 
+ */
+struct CSE_UI_TouchFrame {
+  uint8_t count;  // Number of active points
+  CSE_UI_TouchPoint points [CSEUI_TOUCH_MAX_POINTS];
+  uint32_t timestamp; // Time of acquisition in microseconds
+};
+
+//============================================================================================//
+/**
+ * @brief Input pipeline stage between the touch panel and the widgets. It smooths the
+ * coordinates of each touch point, rejects light touches, and debounces presses and
+ * releases. The edge hysteresis is applied by the widgets when hit-testing. The default
+ * settings pass the raw samples through unchanged.
+ * 
+ */
+class touchFilterClass {
+  private:
+    struct pointState {
+      int16_t historyX [3]; // Last raw samples for the median filter
+      int16_t historyY [3];
+      uint8_t historyCount;
+      int32_t emaX; // Filtered coordinates in 1/16 pixels
+      int32_t emaY;
+      uint8_t pressCount; // Consecutive samples the point has been seen
+      uint8_t releaseCount; // Consecutive samples the point has been missing
+      bool active;  // The point has passed the press debounce
+      CSE_UI_TouchPoint last; // Last filtered point
+    };
+    pointState states [CSEUI_TOUCH_MAX_POINTS];
+  public:
+    uint8_t filterMode; // One of the CSEUI_FILTER_* values
+    uint16_t emaWeight; // Weight of a new sample for CSEUI_FILTER_EMA, 1-256
+    uint8_t pressFrames;  // Samples a point must be seen before it is reported
+    uint8_t releaseFrames;  // Samples a point must be missing before it is released
+    int16_t pressureThreshold;  // Points with lower pressure are ignored
+    int16_t hysteresis; // Pixels a held point may leave a widget before it is released
+
+    touchFilterClass();
+    void setSmoothing (uint8_t mode, uint16_t weight = CSEUI_FILTER_DEF_EMA_WEIGHT);
+    void setDebounce (uint8_t press, uint8_t release);
+    void setHysteresis (int16_t pixels);
+    void apply (CSE_UI_TouchFrame& frame);
+    void reset();
+};
+
+//============================================================================================//
+/**
+ * @brief Records raw touch frames into a compact binary trace. Only frames that differ
+ * from the previous one are written. The trace format is:
+ * 
+ *   Header:  'C' 'S' 'T' 'T' <version:u8> <max points:u8>
+ *   Record:  <time since previous record in us:varint> <count:u8>
+ *            count x (<id:u8> <x:i16 LE> <y:i16 LE> <z:u8>)
+ * 
+ * The varint is little-endian base-128, as in LEB128.
+ * 
+ */
+class touchRecorderClass {
+  private:
+    Print* output;
+    CSE_UI_TouchFrame lastFrame;
+    uint32_t lastTime;  // Timestamp of the last record
+    bool recording;
+    void writeByte (uint8_t b);
+  public:
+    uint32_t frames;  // Records written
+    uint32_t bytes; // Bytes written, including the header
+
+    touchRecorderClass();
+    void begin (Print& out);
+    void end();
+    bool isRecording();
+    void record (const CSE_UI_TouchFrame& frame);
+};
+
+//============================================================================================//
+/**
+ * @brief Plays back a touch trace made by touchRecorderClass. In real-time mode, the
+ * frames are returned at the times they were recorded. In step mode, every read
+ * returns the next record, which is useful for benchmarks that should not depend on
+ * the speed of the target.
+ * 
+ */
+class touchReplayClass {
+  private:
+    const uint8_t* data;
+    uint32_t length;
+    uint32_t position;  // Read position of the next record
+    uint32_t startTime; // micros() when the replay started
+    uint32_t traceTime; // Trace time of the next record
+    bool realTime;
+    CSE_UI_TouchFrame current;  // The frame currently being replayed
+    bool readRecord (CSE_UI_TouchFrame& frame, uint32_t& delta);
+  public:
+    touchReplayClass();
+    bool begin (const uint8_t* trace, uint32_t len, bool realtime = true);
+    void rewind();
+    bool read (CSE_UI_TouchFrame& frame);
+    bool isFinished();
+};
+
+//============================================================================================//
+/**
+ * @brief An event generated by a widget on the render side and dispatched to the
+ * application on the input side.
+ * 
+ */
+struct CSE_UI_Event {
+  uint8_t type; // One of the CSEUI_EVENT_* values
+  void* widget; // The widget that generated the event
+  int16_t x;  // Touch coordinates that caused the event
+  int16_t y;
+  uint32_t timestamp; // Time of the event in microseconds
+};
+
+//============================================================================================//
+/**
+ * @brief A gesture decoded from the touch stream.
+ * 
+ */
+struct CSE_UI_Gesture {
+  uint8_t type; // One of the CSEUI_GESTURE_* values
+  int16_t x;  // Current (or release) position
+  int16_t y;
+  int16_t startX; // Position where the touch started
+  int16_t startY;
+  int16_t dx; // Movement since the last drag report, or since the last one read
+  int16_t dy;
+  float velocityX;  // Release velocity in pixels per second
+  float velocityY;
+  uint32_t timestamp; // Time of the touch frame in microseconds
+};
+
+//============================================================================================//
+/**
+ * @brief Gesture recogniser. Feed it every touch frame and it reports taps, long
+ * presses, drags and flicks. Only the first touch point is tracked.
+ * 
+ */
+class gestureClass {
+  private:
+    uint8_t state;  // Internal state of the recogniser
+    int16_t startX;
+    int16_t startY;
+    int16_t lastX;
+    int16_t lastY;
+    uint32_t downTime;  // Time the touch started, in microseconds
+    uint32_t lastTime;  // Time of the last frame, in microseconds
+    uint32_t lastMoveTime;  // Time of the last movement, in microseconds
+    float velocityX;  // Smoothed velocity in pixels per second
+    float velocityY;
+  public:
+    uint16_t tapSlop; // Max. movement in pixels before a touch becomes a drag
+    uint16_t longPressTime; // Min. hold time in ms for a long press
+    uint16_t flickVelocity; // Min. release velocity in px/s for a flick
+
+    gestureClass();
+    bool update (const CSE_UI_TouchFrame& frame, CSE_UI_Gesture& gesture);
+    void reset();
+};
+
+//============================================================================================//
+/**
+ * @brief Running statistics of touch-to-photon latency. Each sample is the time from
+ * the acquisition of a touch frame to the end of the redraw it caused. Min, max and
+ * average are exact, percentiles are read from a histogram with 1 ms buckets.
+ * 
+ */
+class latencyStatsClass {
+  private:
+    uint32_t histogram [CSEUI_LATENCY_BUCKETS];
+    uint32_t count;
+    uint32_t minValue;
+    uint32_t maxValue;
+    uint64_t sum;
+  public:
+    latencyStatsClass();
+    void record (uint32_t us);
+    void reset();
+    uint32_t getCount();
+    uint32_t getMin();
+    uint32_t getMax();
+    uint32_t getAverage();
+    uint32_t getPercentile (uint8_t pct);
+    void print (Print& out);
+};
+
+//============================================================================================//
+
+#if defined(CSEUI_ENABLE_PROFILER)
+
+/**
+ * @brief Draw profiler. Records, for each widget instance, how often draw() was called,
+ * how often it actually drew something, the time spent in it, and the number of
+ * TFT_eSPI calls and pixels it pushed. It also keeps per-frame totals and a frame time
+ * histogram. Time is counted in CPU cycles on ESP32 and in microseconds elsewhere. The
+ * time spent measuring drawn text for the pixel counts is not counted.
+ * 
+ * Only compiled in when CSEUI_ENABLE_PROFILER is defined. Otherwise the profiling
+ * macros in the widgets expand to nothing.
+ * 
+ */
+class profilerClass {
+  public:
+    struct widgetRecord {
+      const void* widget; // The widget instance
+      const char* type; // Widget type name
+      uint32_t draws; // Number of draw() calls
+      uint32_t redraws; // Number of draw() calls that drew something
+      uint64_t cycles;  // Time spent in draw(), including nested widgets
+      uint32_t pixels;  // Pixels pushed, including nested widgets
+      uint32_t calls; // TFT_eSPI calls made, including nested widgets
+    };
+
+    /**
+     * @brief Measures one draw() call. Create it on the stack at the top of draw().
+     * 
+     */
+    class scope {
+      private:
+        profilerClass* profiler;
+        widgetRecord* record;
+        scope* parent;  // The enclosing scope (a list around its items, for example)
+        uint32_t start;
+        uint32_t excludedStart; // profiler->excluded when the scope started
+      public:
+        uint32_t pixels;
+        uint32_t calls;
+        scope (profilerClass* p, const void* widget, const char* type);
+        ~scope();
+    };
+
+  private:
+    widgetRecord records [CSEUI_PROFILER_MAX_WIDGETS];
+    int recordCount;
+    scope* current; // Innermost active scope
+    uint32_t frameStart;
+    uint32_t excluded;  // Time spent measuring text, taken out of every open scope
+
+  public:
+    uint32_t frames;  // Frames profiled
+    uint32_t frameCalls;  // TFT_eSPI calls in the current frame
+    uint32_t framePixels; // Pixels in the current frame
+    uint64_t totalCalls;  // TFT_eSPI calls in all frames
+    uint64_t totalPixels; // Pixels in all frames
+    latencyStatsClass frameTimes; // Frame time histogram
+
+    profilerClass();
+    static uint32_t now();
+    widgetRecord* find (const void* widget, const char* type);
+    void addCall (uint32_t pixels);
+    void addText (TFT_eSPI* lcd, const String& text, int16_t height);
+    void addText (TFT_eSPI* lcd, const char* text, int16_t height);
+    void beginFrame();
+    void endFrame();
+    void reset();
+    void print (uint8_t topN, Print& out);
+};
+
+  #define   CSEUI_PROFILER_SCOPE(type) profilerClass::scope cseuiProfileScope (&uiParent->profiler, this, type)
+  #define   CSEUI_PROFILE_CALL(pixels)  uiParent->profiler.addCall (pixels)
+  #define   CSEUI_PROFILE_TEXT(text, height)  uiParent->profiler.addText (uiParent->lcdParent, text, height)
+#else
+  #define   CSEUI_PROFILER_SCOPE(type)
+  #define   CSEUI_PROFILE_CALL(pixels)
+  #define   CSEUI_PROFILE_TEXT(text, height)
+#endif
 
 //============================================================================================//
 
+#if defined(CSEUI_ENABLE_ALLOC_TRACKING)
+/**
+ * @brief Heap allocation tracker. Counts the allocations and allocated bytes of each
+ * frame and of each widget draw() call, and can flag every steady-state frame that
+ * allocates.
+ * 
+ * By default, only the global operator new and delete are replaced to count allocations.
+ * malloc() calls are NOT counted by default, and Arduino String allocates with malloc(),
+ * so String churn does not show up. To count it, also define CSEUI_ALLOC_WRAP_MALLOC and
+ * link with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free
+ * 
+ * The counters are updated atomically, so allocations from other tasks or cores are not
+ * lost.
+ * 
+ * The counters are global, so allocations made by other tasks during a frame are
+ * counted too. Only compiled in when CSEUI_ENABLE_ALLOC_TRACKING is defined.
+ * 
+ */
+class allocTrackerClass {
+  public:
+    typedef void (*failFuncPtr)(uint32_t frame, uint32_t allocs, uint32_t bytes);
+
+    struct widgetRecord {
+      const void* widget; // The widget instance
+      const char* type; // Widget type name
+      uint32_t draws; // Number of draw() calls
+      uint32_t allocs;  // Allocations made in draw(), including nested widgets
+      uint32_t bytes; // Bytes allocated in draw(), including nested widgets
+    };
+
+    /**
+     * @brief Counts the allocations of one draw() call. Create it on the stack at the top
+     * of draw().
+     * 
+     */
+    class scope {
+      private:
+        widgetRecord* record;
+        uint32_t startAllocs;
+        uint32_t startBytes;
+      public:
+        scope (allocTrackerClass* t, const void* widget, const char* type);
+        ~scope();
+    };
+
+  private:
+    widgetRecord records [CSEUI_ALLOC_MAX_WIDGETS];
+    int recordCount;
+    uint32_t frameStartAllocs;
+    uint32_t frameStartBytes;
+    bool assertEnabled;
+    uint32_t warmupFrames;  // Frames to ignore before asserting
+    failFuncPtr failHandler;
+
+  public:
+  #if defined(ARDUINO_ARCH_AVR)
+    static volatile uint32_t allocs;  // Allocations counted since startup
+    static volatile uint32_t bytes; // Bytes requested since startup
+    static volatile uint32_t frees; // Frees counted since startup
+  #else
+    static std::atomic <uint32_t> allocs; // Allocations counted since startup, from any task
+    static std::atomic <uint32_t> bytes;  // Bytes requested since startup
+    static std::atomic <uint32_t> frees;  // Frees counted since startup
+  #endif
+
+    uint32_t frames;  // Frames tracked
+    uint32_t frameAllocs; // Allocations in the last frame
+    uint32_t frameBytes;  // Bytes allocated in the last frame
+    uint32_t maxFrameAllocs;  // Most allocations in a single frame
+    uint32_t maxFrameBytes; // Most bytes allocated in a single frame
+    uint32_t allocatingFrames;  // Frames that allocated at all
+    uint32_t failures;  // Steady-state frames that allocated while asserting
+
+    allocTrackerClass();
+    static void recordAlloc (size_t size);
+    static void recordFree();
+    widgetRecord* find (const void* widget, const char* type);
+    void beginFrame();
+    void endFrame();
+    void enableAssert (uint32_t warmup = 0, failFuncPtr handler = NULL);
+    void disableAssert();
+    void reset();
+    void print (Print& out);
+};
+
+  #define   CSEUI_ALLOC_SCOPE(type)     allocTrackerClass::scope cseuiAllocScope (&uiParent->allocTracker, this, type)
+#else
+  #define   CSEUI_ALLOC_SCOPE(type)
+#endif
+
+// Put at the top of a widget draw() function to profile it
+#define   CSEUI_PROFILE_SCOPE(type)   CSEUI_PROFILER_SCOPE (type); CSEUI_ALLOC_SCOPE (type)
+
+//============================================================================================//
+/**
+ * @brief A read-only source of bytes with random access. Widgets that show large content,
+ * such as the text viewer, read it in small chunks through this interface instead of
+ * keeping it in RAM.
+ * 
+ */
+class byteSourceClass {
+  public:
+    virtual ~byteSourceClass() {}
+    virtual uint32_t size() = 0;
+    virtual size_t read (uint32_t offset, uint8_t* buffer, size_t length) = 0;
+};
+
+//============================================================================================//
+/**
+ * @brief Byte source for data in memory, such as a PROGMEM array on ESP32 or a buffer.
+ * 
+ */
+class memorySourceClass : public byteSourceClass {
+  private:
+    const uint8_t* data;
+    uint32_t length;
+  public:
+    memorySourceClass (const uint8_t* data, uint32_t length);
+    uint32_t size();
+    size_t read (uint32_t offset, uint8_t* buffer, size_t count);
+};
+
+#if defined(ARDUINO_ARCH_ESP32) || defined(CSEUI_HOST_BUILD)
+/**
+ * @brief Byte source for a file. On ESP32 it takes an open SPIFFS, LittleFS or SD file,
+ * and on the host build a file opened with fopen().
+ * 
+ */
+class fileSourceClass : public byteSourceClass {
+  private:
+  #if defined(ARDUINO_ARCH_ESP32)
+    fs::File file;
+  #else
+    FILE* file;
+  #endif
+    uint32_t length;
+  public:
+  #if defined(ARDUINO_ARCH_ESP32)
+    fileSourceClass (fs::File file);
+  #else
+    fileSourceClass (FILE* file);
+  #endif
+    uint32_t size();
+    size_t read (uint32_t offset, uint8_t* buffer, size_t count);
+};
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32)
+/**
+ * @brief Byte source for raw data in a flash partition.
+ * 
+ */
+class partitionSourceClass : public byteSourceClass {
+  private:
+    const esp_partition_t* partition;
+    uint32_t length;
+  public:
+    partitionSourceClass (const esp_partition_t* partition, uint32_t length = 0);
+    uint32_t size();
+    size_t read (uint32_t offset, uint8_t* buffer, size_t count);
+};
+#endif
+
+//============================================================================================//
+
+class iconAtlasClass;
+class pageClass;
+class transitionClass;
+class widgetClass;
+class dialogClass;
+
+//============================================================================================//
+/**
+ * @brief The UI parent object. It holds the LCD and touch panel, the touch snapshot of
+ * the current frame, and optionally runs the input and render tasks on separate cores.
+ * 
+ * When the tasks are running, the render task owns every widget. Widget members must
+ * only be changed from the render function, or from other tasks while holding
+ * lockState(). The input task only samples the touch panel and dispatches events.
+ * 
+ */
 class CSE_UI {
+  public:
+    typedef void (*funcPtr)();
+    typedef void (*eventFuncPtr)(const CSE_UI_Event&);
+
+  private:
+    funcPtr renderFunction; // Called by the render task once per frame
+    eventFuncPtr eventHandler;  // Called by the input task for each widget event
+    CSE_UI_Queue <CSE_UI_TouchFrame, CSEUI_INPUT_QUEUE_LENGTH> inputQueue;  // Input -> render
+    CSE_UI_Queue <CSE_UI_Event, CSEUI_EVENT_QUEUE_LENGTH> eventQueue; // Render -> input
+    CSE_UI_Queue <CSE_UI_Gesture, CSEUI_GESTURE_QUEUE_LENGTH> gestureQueue; // Input -> render
+    CSE_UI_Mutex stateMutex;  // Guards widget state while a frame is rendered
+    CSE_UI_TouchFrame lastInputFrame; // Last frame pushed by the input task
+    void* touchOwner [CSEUI_TOUCH_MAX_POINTS];  // The widget holding each touch point ID
+    touchRecorderClass* touchRecorder;  // Records the raw touch frames, if set
+    touchReplayClass* touchReplay;  // Replaces the touch panel, if set
+    void readPanel (CSE_UI_TouchFrame& frame);
+    void startFrame (bool queued);
+    void queueGesture (const CSE_UI_Gesture& g);
+    uint32_t touchSampleTime; // micros() of the last panel read outside a frame
+    bool touchSampleValid;  // touchSampleTime holds a read
+    bool touchChanged;  // The touch snapshot of this frame differs from the one before
+    CSE_UI_TouchFrame prevTouchFrame; // The snapshot before the current one
+
+  #if defined(ARDUINO_ARCH_AVR)
+    volatile bool tasksRunning;
+  #else
+    std::atomic <bool> tasksRunning;  // Read by both tasks, cleared by endTasks()
+  #endif
+
+  #if defined(ARDUINO_ARCH_ESP32)
+    TaskHandle_t inputTask;
+    TaskHandle_t renderTask;
+    SemaphoreHandle_t taskExit; // Given by each task as it exits
+  #elif defined(CSEUI_HOST_BUILD)
+    std::thread inputThread;
+    std::thread renderThread;
+  #endif
+
   public:
     TFT_eSPI* lcdParent;
     CSE_Touch* tsParent;
@@ -59,35 +846,310 @@ class CSE_UI {
     CSE_UI (TFT_eSPI* lcd, CSE_Touch* ts);
     int currentPage;
     int prevPage;
+
+    CSE_UI_TouchFrame touchFrame; // The touch snapshot of the current frame
+    bool frameActive; // True between beginFrame() and endFrame()
+    touchFilterClass touchFilter; // Smoothing and debouncing of the raw samples
+    gestureClass gesture; // Gesture recogniser run on the input side
+    latencyStatsClass latency;  // Touch-to-photon latency of widget redraws
+    iconAtlasClass* iconAtlas;  // Cache of rasterised icons used by the buttons, if set
+    int16_t originX;  // Screen position of the top-left of the draw target
+    int16_t originY;
+    bool clipActive;  // Viewports are clipped to the clip rectangle
+    bool clipExact; // No viewport had to ignore the clip rectangle since setClip()
+    int16_t clipX;  // Clip rectangle in screen coordinates
+    int16_t clipY;
+    int16_t clipWidth;
+    int16_t clipHeight;
+    pageClass* firstPage; // Pages added with addPage()
+    pageClass* activePage;  // Page shown with showPage(), or NULL
+    transitionClass* pageTransition;  // Renders the transitions of showPage(), if set
+    size_t pageBudget;  // Bytes of page arenas kept in RAM; 0 for no limit
+    uint32_t pageUseCounter;  // Incremented on each showPage(), for the LRU order
+    widgetClass* focusWidget; // Drawn first by tick(), if set
+    dialogClass* modalDialog; // The open dialog, or NULL
+    uint32_t tickTime;  // Microseconds taken by the last tick()
+    uint16_t tickDrawn; // Widgets drawn in the last tick()
+    uint16_t tickPending; // Dirty widgets left for the next tick()
+
+  #if defined(CSEUI_ENABLE_PROFILER)
+    profilerClass profiler; // Per-widget draw statistics
+  #endif
+  #if defined(CSEUI_ENABLE_ALLOC_TRACKING)
+    allocTrackerClass allocTracker; // Per-frame and per-widget allocation counts
+  #endif
+    bool gestureEnabled;  // Run the gesture recogniser
+
+    bool sampleTouch (CSE_UI_TouchFrame& frame);
+    bool readTouch();
+    const CSE_UI_TouchFrame& getTouchFrame();
+    void setTouchRecorder (touchRecorderClass* recorder);
+    void setTouchReplay (touchReplayClass* replay);
+    void setIconAtlas (iconAtlasClass* atlas);
+    bool addPage (pageClass* page);
+    pageClass* getPage (int pageNum);
+    bool showPage (int pageNum, uint8_t transition = CSEUI_TRANSITION_NONE, uint16_t duration = CSEUI_TRANSITION_DEF_DURATION);
+    void setTransition (transitionClass* transition);
+    bool drawPage();
+    uint16_t tick (uint32_t budget = CSEUI_TICK_DEF_BUDGET);
+    void setFocus (widgetClass* widget);
+    void setClip (int16_t x, int16_t y, int16_t w, int16_t h);
+    void clearClip();
+    void setPageBudget (size_t bytes);
+    size_t getPageMemory();
+    void trimPages (size_t reserve = 0, pageClass* keep = NULL);
+    const CSE_UI_TouchPoint* findTouchPoint (uint8_t id);
+    bool claimTouch (uint8_t id, void* widget);
+    void releaseTouch (uint8_t id, void* widget);
+    void updateTouchOwners();
+    void beginFrame();
+    void endFrame();
+
+    TFT_eSPI* setDrawTarget (TFT_eSPI* target);
+    void setOrigin (int16_t x, int16_t y);
+    void setViewport (int32_t x, int32_t y, int32_t w, int32_t h, bool datum = true);
+    void resetViewport();
+    uint32_t getFontId();
+
+    void enableGestures();
+    void disableGestures();
+    bool getGesture (CSE_UI_Gesture& g);
+
+    void recordLatency (uint32_t inputTime);
+    void startLatency (widgetClass* widget);
+    void finishLatency (widgetClass* widget);
+    uint32_t getLatencyMin();
+    uint32_t getLatencyAverage();
+    uint32_t getLatencyP99();
+    void printLatency (Print& out);
+    void printProfile (uint8_t topN, Print& out);
+    void printAllocations (Print& out);
+
+    void setEventHandler (eventFuncPtr func);
+    void postEvent (uint8_t type, void* widget, int16_t x, int16_t y);
+    void dispatchEvents();
+    void forgetPage (pageClass* page);
+
+    void setRenderFunction (funcPtr func);
+    bool beginTasks (uint8_t inputCore = 0, uint8_t renderCore = 1);
+    void endTasks();
+    bool isRunningTasks();
+    void exitTask();
+    void inputStep();
+    void renderStep();
+    void lockState();
+    void unlockState();
+};
+
+//============================================================================================//
+/**
+ * @brief Renders widgets into an off-screen sprite instead of the LCD, so that the
+ * output pixels can be checked. Use it to compare scenes against reference images
+ * after rendering changes. Images can be written out as BMP files, including a diff
+ * image that marks the pixels that differ from a reference.
+ * 
+ */
+class captureClass {
+  private:
+    CSE_UI* uiParent;
+    TFT_eSprite* sprite;
+    TFT_eSPI* prevTarget; // Draw target to restore after the capture
+    int16_t originX;  // Screen coordinates of the top-left of the capture
+    int16_t originY;
+    void writeBMPHeader (Print& out);
+  public:
+    int16_t width;
+    int16_t height;
+
+    captureClass (CSE_UI* ui);
+    ~captureClass();
+    bool begin (int16_t x, int16_t y, int16_t w, int16_t h);
+    void end();
+    void start (uint16_t bgColor);
+    void stop();
+    uint16_t getPixel (int16_t x, int16_t y);
+    uint32_t checksum();
+    uint32_t compare (const uint16_t* reference);
+    void writeRaw (Print& out);
+    void writeBMP (Print& out);
+    void writeDiffBMP (const uint16_t* reference, Print& out);
+};
+
+//============================================================================================//
+/**
+ * @brief Base class of the widgets. It lets pages hold and draw widgets of any type, and
+ * the screen loader create them. Widgets of a page are kept in a singly linked list, so
+ * adding them to a page does not allocate.
+ * 
+ */
+class widgetClass {
+  public:
+    widgetClass* nextWidget;  // Next widget of the page, or NULL
+    uint8_t widgetType; // One of the CSEUI_WIDGET_xxx values
+    uint16_t widgetId;  // ID given by the screen file, or 0
+    uint8_t drawPriority; // Widgets with a higher priority are drawn first by tick()
+    uint8_t drawAge;  // Ticks the widget has waited to be drawn
+    uint32_t drawTime;  // Microseconds taken by the last draw through tick()
+    uint8_t zOrder; // Stacking order on the page; higher is drawn later, on top
+    bool opaque;  // The widget covers every pixel of its bounds when drawn
+    bool latencyPending;  // Became dirty in a frame with new touch input; the redraw is timed
+    uint32_t latencyStart;  // Acquisition time of that touch frame
+
+    widgetClass();
+    virtual ~widgetClass() {}
+    virtual void draw() = 0;
+    virtual void reset() {}
+    virtual void invalidate() = 0;  // Redraw the whole widget in the next draw
+    virtual bool isDirty() { return true; } // The next draw would change the screen
+    virtual bool getBounds (int16_t&, int16_t&, int16_t&, int16_t&) { return false; } // Area drawn; false if hidden or not known
+    virtual bool getOpaqueBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) { return opaque && getBounds (x, y, w, h); } // Area covered completely when drawn
+    virtual bool getChangedBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) { return getBounds (x, y, w, h); } // Area changed by the last draw; false if none
 };
 
 //============================================================================================//
+/**
+ * @brief A bump allocator over a fixed buffer. Objects created with create() are
+ * destroyed, newest first, when the arena is reset, and the whole buffer is then free
+ * again at once. Nothing is freed individually, so the heap is not fragmented.
+ * 
+ */
+class arenaClass {
+  private:
+    struct destructorNode {
+      void (*destroy) (void* object);
+      void* object;
+      destructorNode* next;
+    };
+
+    uint8_t* buffer;
+    bool ownsBuffer;  // The buffer was allocated by begin (size)
+    destructorNode* destructors;  // Objects to destroy on reset, newest first
+
+    template <class T> static void destroyObject (void* object) {
+      ((T*) object)->~T();
+    }
+
+    static size_t alignSize (size_t size) {
+      return (size + CSEUI_ARENA_ALIGN - 1) & ~((size_t) CSEUI_ARENA_ALIGN - 1);
+    }
+
+  public:
+    size_t capacity; // Size of the buffer in bytes
+    size_t used;  // Bytes allocated since the last reset
+    size_t peak;  // Highest number of bytes used
+    uint32_t failures;  // Allocations that did not fit
+
+    arenaClass();
+    ~arenaClass();
+    bool begin (size_t size);
+    bool begin (void* buf, size_t size);
+    void end();
+    void* allocate (size_t size);
+    void reset();
+    bool contains (const void* object);
+
+    // Creates an object of a widget class (or any class with a CSE_UI* constructor) in
+    // the arena. Returns NULL if the arena is full.
+    template <class T> T* create (CSE_UI* ui) {
+      destructorNode* node = (destructorNode*) allocate (sizeof (destructorNode));
+      void* memory = (node != NULL) ? allocate (sizeof (T)) : NULL;
+
+      if (memory == NULL) return NULL;
+
+      T* object = new (memory) T (ui);
+      node->destroy = destroyObject <T>;
+      node->object = object;
+      node->next = destructors;
+      destructors = node;
+      return object;
+    }
+
+    // Bytes taken by create <T>()
+    template <class T> static size_t objectSize() {
+      return alignSize (sizeof (destructorNode)) + alignSize (sizeof (T));
+    }
+};
+
+class screenLoaderClass;
 
+//============================================================================================//
+/**
+ * @brief A page of the UI. A page can own its widgets: widgets loaded from a screen file
+ * or created with create() are placed in the page arena when the page is initialized,
+ * and are all destroyed at once when the page is left with leave().
+ * 
+ */
 class pageClass {
   private:
     bool pageActive;
     typedef void (*funcPtr)();
     funcPtr drawFunction;
     funcPtr initFunction;
+    bool bgDrawn; // The background was filled since the page was activated
   public:
     CSE_UI* uiParent;
     int pageNum;
+    widgetClass* firstWidget; // Widgets of the page, bottom first, in z-order
+    widgetClass* lastWidget;
+    uint16_t widgetCount;
+    int32_t bgColor;  // Filled when the page is activated, or -1 for no fill
+    arenaClass arena; // Widgets owned by the page
+    size_t arenaSize; // Size given to setArenaSize(), or 0 to size the arena for the screen file
+    screenLoaderClass* screen;  // Screen file the widgets are loaded from, if set
+    bool initialized; // init() was called since the page was last released
+    pageClass* nextPage;  // Next page added to the UI
+    uint32_t lastUsed;  // Value of the UI page counter when the page was last shown
 
     pageClass (CSE_UI* ui, int page);
     void setInitFunction (funcPtr func);
     void setDrawFunction (funcPtr func);
+    void setScreen (screenLoaderClass* loader);
+    void setArenaSize (size_t size);
     bool isActive();
     bool setActive();
     bool setInactive();
     bool init();
     bool draw();
+    void drawBackground();
+    void redraw();
+    bool enter();
+    void leave();
+    void release();
+    void evict();
+    size_t getMemory();
+    size_t getArenaSize();
+    void addWidget (widgetClass* widget);
+    widgetClass* findWidget (uint16_t id);
+    bool ownsWidget (const void* widget);
+    void clearWidgets();
+    void setZOrder (widgetClass* widget, uint8_t z);
+    bool drawWidget (widgetClass* widget);
+    void invalidateArea (int16_t x, int16_t y, int16_t w, int16_t h);
+    void invalidate();
+
+    // Creates a widget in the page arena and adds it to the page. Returns NULL if the
+    // arena is full.
+    template <class T> T* create() {
+      T* widget = arena.create <T> (uiParent);
+
+      if (widget != NULL) {
+        addWidget (widget);
+      }
+      return widget;
+    }
 };
 
 //============================================================================================//
 
-class lcdString {
+class lcdString : public widgetClass {
   private:
     CSE_UI* uiParent;
+    int16_t drawnX; // Area of the string on the screen, valid while prevState is true
+    int16_t drawnY;
+    int16_t drawnWidth;
+    int16_t drawnHeight;
+
+    void measure (const String& str, int16_t& x, int16_t& y, int16_t& w, int16_t& h);
   public:
     uint16_t stringX; //x coordinate
     uint16_t stringY; //y coordinate
@@ -104,13 +1166,18 @@ class lcdString {
     bool prevState; //used to detect if the text was displayed before hiding it
 
     lcdString (CSE_UI* ui); //constructor
-    void initialize (String str, int x, int y, uint16_t fcolor, uint16_t bcolor, bool visibility, const uint8_t* font = nullptr); //initilizes the object. call this from first function executed after restart
+    void initialize (const String& str, int x, int y, uint16_t fcolor, uint16_t bcolor, bool visibility, const uint8_t* font = nullptr); //initilizes the object. call this from first function executed after restart
     void draw(); //draw the text to LCD
     void show(); //show the text
     void hide(); //hide the text. if text was previously drawn, the text area will be cleared with bg color
     void update(); //triggers a state change and redraws the text
-    void update (String); //update the text with a new string and redraw it
+    void update (const char* str); //update the text with a new string and redraw it
+    void update (const String& str);
+    void update (String&& str);
     void setTextDatum (uint8_t datum);
+    void invalidate();
+    bool isDirty();
+    bool getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h);
 };
 
 //============================================================================================//
@@ -143,6 +1210,12 @@ class iconClass {
     friend class boxClass;
 
     const char* fontArray;
+    const uint8_t* spanArray; // Span-encoded icon data, or NULL
+    const uint8_t* alphaArray; // 4-bit alpha icon data, or NULL
+    uint16_t blendColors [16]; // Colors for the 16 alpha levels of the last color pair
+    uint16_t blendFg; // Foreground color of blendColors
+    uint16_t blendBg; // Background color of blendColors
+    bool blendValid; // blendColors is computed
     int fontWidth; //width of each char (don't worry; char widths are still variable)
     int fontHeight; //font height
     int charByteLength; //count of bytes for each char
@@ -151,18 +1224,64 @@ class iconClass {
     int glyphHeight;
     int glyphX;
     int glyphY;
+    bool sizeValid; // The glyph bounds are known
     uint32_t unicodeId;
     String name;
 
     //------------------------------------------------------------------------//
 
     iconClass (CSE_UI* ui);
-    void initialize (const char* array, int w, int h, int byteLen, int byteCount, uint32_t unicode, String str);
-    void initialize (const char* font, uint32_t unicode, String name);
+    void initialize (const char* array, int w, int h, int byteLen, int byteCount, uint32_t unicode, const String& str);
+    void initialize (const char* font, uint32_t unicode, const String& name);
+    bool initializeSpans (const uint8_t* spans, uint32_t unicode, const String& name);
+    bool initializeAlpha (const uint8_t* alpha, uint32_t unicode, const String& name);
     void draw (int16_t x, int16_t y, uint16_t color);
+    void draw (int16_t x, int16_t y, uint16_t color, uint16_t bgColor);
+    void drawSpans (int16_t x, int16_t y, uint16_t color);
+    void drawAlpha (int16_t x, int16_t y, uint16_t color, uint16_t bgColor);
+    void setBlendColors (uint16_t color, uint16_t bgColor);
+    void rasterize (uint16_t* buffer, uint16_t color, uint16_t bgColor);
     void getSize(); //calculates the absolute width and height of an icon
 };
 
+//============================================================================================//
+/**
+ * @brief A cache of icons rasterised in a given color on a given background. The first
+ * draw of an icon in a color rasterises it into a cell of an RGB565 sheet; later draws
+ * push the cell with a single pushImage(). The sheet has a fixed number of cells of the
+ * same size, and the least recently used cell is reused when the sheet is full. On ESP32,
+ * the sheet is placed in PSRAM if available.
+ * 
+ */
+class iconAtlasClass {
+  private:
+    struct atlasEntry {
+      const iconClass* icon;  // Icon in the cell, or NULL if the cell is free
+      uint16_t color;
+      uint16_t bgColor;
+      uint32_t lastUsed;  // Use counter at the last draw
+    };
+
+    CSE_UI* uiParent;
+    uint16_t* sheet;
+    std::vector<atlasEntry> entries;
+    uint32_t useCounter;
+
+  public:
+    uint16_t cellWidth;
+    uint16_t cellHeight;
+    uint32_t hits; // Draws served from the sheet
+    uint32_t misses;  // Draws that rasterised an icon
+    uint32_t evictions; // Cells reused for another icon
+
+    iconAtlasClass (CSE_UI* ui);
+    ~iconAtlasClass();
+    bool begin (uint16_t w, uint16_t h, uint16_t cells);
+    void end();
+    void clear();
+    bool draw (iconClass* icon, int16_t x, int16_t y, uint16_t color, uint16_t bgColor);
+};
+
 //============================================================================================//
 /**
  * @brief Class for creating rectangular and rounded-rectangular buttons. Buttons can
@@ -171,9 +1290,10 @@ class iconClass {
  * text box etc.
  * 
  */
-class buttonClass {
+class buttonClass : public widgetClass {
   private:
     CSE_UI* uiParent; // Pointer to the parent CSE_UI object
+    void drawIcon (int16_t x, int16_t y, uint16_t color);
   public:
     // friend class fontClass;
     friend class iconClass;
@@ -197,6 +1317,7 @@ class buttonClass {
     int iconAlign;  // Alignment of the icon on the button
     int iconOffsetX;  // X-offset of the icon from the alignment point
     int iconOffsetY;  // Y-offset of the icon from the alignment point
+    int32_t iconFill; // Fill color behind the icon in the current draw, or -1 if there is no fill
     uint16_t labelColor;  // Color of the text
     uint16_t labelHoverColor; // Color of the text when hovered
     uint16_t iconColor; // Color of the icon
@@ -214,6 +1335,8 @@ class buttonClass {
     bool iconHoverEnabled;  // Enable or disable the hover effect on the icon
     bool prevTouchState;  // Previous touch state
     bool currentTouchState; // Current touch state
+    int8_t touchId; // ID of the touch point holding the button, or -1
+    bool drawChanged; // The last draw() drew the button
     bool stateChange; // Set true to trigger a state change and thus causing the button to be redrawn
 
     // A button can enter an intermediate state after touched. This can be used to toggle the
@@ -224,7 +1347,10 @@ class buttonClass {
     // Function descriptions can be found in the .cpp file
 
     buttonClass (CSE_UI* ui);
-    void initialize (int16_t x,int16_t y, int16_t w, int16_t h, uint16_t fcolor, uint16_t lcolor, String label);
+    void initialize (int16_t x,int16_t y, int16_t w, int16_t h, uint16_t fcolor, uint16_t lcolor, const String& label);
+    bool setLabel (const char* label);
+    bool setLabel (const String& label);
+    bool setLabel (String&& label);
 
     void draw();
     void show();
@@ -232,6 +1358,11 @@ class buttonClass {
     void enable();
     void disable();
     void reset();
+    void invalidate();
+    bool isDirty();
+    bool getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h);
+    bool getOpaqueBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h);
+    bool getChangedBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h);
     void clear (uint32_t);
     void setXY (int, int);
     void hoverEnable();
@@ -253,6 +1384,7 @@ class buttonClass {
     void iconHoverEnable();
     void iconHoverDisable();
     bool isTouched();
+    bool contains (int16_t x, int16_t y, int16_t margin = 0);
     bool isPressed();
     void updateState (bool);
     bool getState();
@@ -268,7 +1400,7 @@ class buttonClass {
  * will be a button object. Any number of items can be added dynamically.
  * 
  */
-class listClass {
+class listClass : public widgetClass {
   private:
     CSE_UI* uiParent;
     // buttonClass* itemList;
@@ -294,12 +1426,30 @@ class listClass {
     uint16_t itemHoverBgColor;  // The color of the item background/fill when hovered
     bool visible; // Show or hide the list
 
+    // Kinetic (pixel-offset) scrolling
+    bool kineticEnabled;  // Scroll by pixels instead of by items
+    int32_t scrollOffset; // Pixel offset of the top of the viewport from the first item
+    int32_t drawnOffset;  // Pixel offset that is currently on the screen
+    float scrollVelocity; // Current kinetic velocity in pixels per second
+    float scrollRemainder;  // Sub-pixel part of the kinetic movement not scrolled yet
+    float scrollFriction; // Deceleration in pixels per second^2
+    uint32_t kineticTime; // Time of the last kinetic update, in microseconds
+    bool kineticRedraw; // Set true to redraw all visible rows in the next draw
+    int kineticFocusPrev; // Focused item that needs to be redrawn unfocused
+    TFT_eSprite* scrollSprite;  // Optional viewport buffer for incremental scrolling
+
     // Function descriptions can be found in the .cpp file
 
     listClass (CSE_UI* ui);
+    ~listClass();
     void initialize (int16_t x, int16_t y, int w, int h, uint16_t fgcolor, uint16_t bgcolor, uint16_t focusfg, uint16_t focusbg);
-    void addItem (buttonClass* item, String label);
+    void addItem (buttonClass* item, const String& label);
+    buttonClass* addItem (const String& label, arenaClass* arena);
+    void reserveItems (int count);
     void reset();
+    void invalidate();
+    bool isDirty();
+    bool getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h);
     void triggerStateChange();
     void setCurrentItem (int item);
     int getCurrentItem();
@@ -307,18 +1457,60 @@ class listClass {
     void toPrevItem();
     void scrollUp();
     void scrollDown();
+    void enableKineticScroll (bool useSprite = true);
+    void disableKineticScroll();
+    void scrollBy (int32_t dy);
+    void fling (float velocity);
+    void stopScroll();
+    bool handleGesture (const CSE_UI_Gesture& g);
+    int getViewHeight();
     void setTextAlign (int datum);
     void setTextPadding (int xPad, int yPad);
     void draw();
     void show();
     void hide();
+
+  private:
+    void showCurrentItem();
+    void updateKinetic();
+    void drawRow (int index, int16_t y);
+    void drawKinetic();
 };
 
 //============================================================================================//
 
-class textAreaClass {
+class textAreaClass : public widgetClass {
   private:
     CSE_UI* uiParent;
+
+    struct textLine {
+      uint16_t start; // Byte offset of the line in the text
+      uint16_t length;  // Bytes in the line, without the break
+      int16_t width;  // Width of the line in pixels
+    };
+
+    std::vector<textLine> lines;  // Cached layout of the visible lines
+    std::vector<textLine> drawnLines; // The lines currently on the screen
+    int16_t layoutWidth;  // Width the layout was made for
+    int16_t layoutLineHeight; // Line height the layout was made for
+    uint32_t layoutFontId;  // getFontId() of the font the layout was made with
+    bool layoutValid;
+    uint16_t drawnFgColor;  // Style of the area currently on the screen
+    uint16_t drawnBgColor;
+    uint16_t drawnBorderColor;
+    int drawnBorderThickness;
+    int16_t changedX; // Area changed by the last draw, in screen coordinates
+    int16_t changedY;
+    int16_t changedWidth;
+    int16_t changedHeight;
+
+    uint16_t commonPrefix (const String& a, const String& b);
+    int16_t glyphWidth (uint16_t pos, uint8_t* len);
+    int16_t rangeWidth (uint16_t from, uint16_t to);
+    void layoutText (uint16_t changedAt);
+    void drawLines();
+    void drawChangedLines (uint16_t changedAt);
+    void addChanged (int16_t x, int16_t y, int16_t w, int16_t h);
   public:
     int areaX;
     int areaY;
@@ -347,21 +1539,158 @@ class textAreaClass {
     bool stateChanged;
 
     textAreaClass (CSE_UI* ui);
-    void initialize (int x, int y, int w, int h, uint16_t fgcolor, uint16_t bgcolor, uint16_t brcolor, String n);
+    void initialize (int x, int y, int w, int h, uint16_t fgcolor, uint16_t bgcolor, uint16_t brcolor, const String& n);
     void open();
     void close();
     void draw();
     void update();
     void reset();
+    void invalidate();
+    bool getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h);
+    bool getChangedBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h);
+    bool isDirty();
     void enableText();
     void disableText();
-    void setText (String str);
-    void appendText (String str);
+    void setText (const char* str);
+    void setText (const String& str);
+    void setText (String&& str);
+    void appendText (const char* str);
+    void appendText (const String& str);
     void clearText();
+    int getLineCount();
 
     void setAreaPadding (int l = 0, int t = 0, int r = 0, int b = 0);
 };
 
+//============================================================================================//
+/**
+ * @brief A scrollable viewer for texts that are too large for RAM, such as manuals, logs
+ * and configuration files. The text is read from a byte source. On the first draw, the
+ * source is scanned once to build a sparse index with the offset of every
+ * CSEUI_VIEWER_INDEX_STEP-th line. Only the visible lines are then read and drawn, so
+ * memory use depends on the viewport size and not on the size of the text.
+ * 
+ * Lines end at '\n' and are not wrapped; lines wider than the viewer are cut.
+ * 
+ * Only the rows whose text changed are redrawn. When scrolled by less than a screen, the
+ * rows still visible are moved with readRect() and pushRect() if the LCD can be read
+ * back, so only the new lines are drawn.
+ * 
+ */
+class textViewerClass : public widgetClass {
+  private:
+    CSE_UI* uiParent;
+    byteSourceClass* source;
+    std::vector<uint32_t> lineIndex;  // Offset of every CSEUI_VIEWER_INDEX_STEP-th line
+    uint32_t lineCount;
+    bool indexed; // The source has been scanned
+    uint32_t drawnTopLine;  // First line on the screen, for detecting scrolls
+    int drawnLineHeight;  // Font height of the drawn rows; 0 if nothing is drawn
+    uint32_t drawnFontId; // getFontId() of the font of the drawn rows
+    std::vector<uint32_t> rowHash;  // Hash of the text of each drawn row; 0 if unknown
+    std::vector<uint16_t> rowBuffer;  // One row of pixels for scrolling, allocated once
+
+    void buildIndex();
+    uint32_t findLine (uint32_t line);
+    uint32_t readLine (uint32_t offset, char* buffer);
+    void scrollPixels (int32_t lines, int lineHeight);
+
+  public:
+    int viewerX;
+    int viewerY;
+    int viewerWidth;
+    int viewerHeight;
+    uint16_t viewerFgColor;
+    uint16_t viewerBgColor;
+    uint32_t topLine; // First visible line
+    bool viewerVisible;
+    bool stateChanged;
+
+    textViewerClass (CSE_UI* ui);
+    void initialize (int x, int y, int w, int h, uint16_t fgcolor, uint16_t bgcolor);
+    void setSource (byteSourceClass* src);
+    void draw();
+    void reset();
+    void invalidate();
+    bool getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h);
+    bool isDirty();
+    void show();
+    void hide();
+    void scrollTo (uint32_t line);
+    void scrollBy (int32_t lines);
+    uint32_t getLineCount();
+    uint32_t getVisibleLineCount();
+};
+
+//============================================================================================//
+/**
+ * @brief An image streamed from a byte source. The image is decoded a strip of rows at a
+ * time into a small buffer that is pushed to the LCD, so even full-screen images need
+ * only a strip buffer of width x strip height pixels. The buffer is allocated on the first
+ * draw and kept for later draws, or provided by the caller with setStripBuffer() so that
+ * several images can share one.
+ * 
+ * The image starts with a CSEUI_IMAGE_HEADER_SIZE byte header: "CSI", the format, the
+ * width and height (16-bit little-endian) and the number of palette entries (16-bit
+ * little-endian). Palette images follow with the RGB565 palette, and then the pixel data.
+ * RLE data is a sequence of runs with a count byte c; if bit 7 is set, the next pixel is
+ * repeated (c & 0x7F) + 1 times, otherwise c + 1 literal pixels follow. Runs can cross
+ * rows. All RGB565 values are little-endian.
+ * 
+ */
+class imageClass : public widgetClass {
+  private:
+    CSE_UI* uiParent;
+    byteSourceClass* source;
+    std::vector<uint16_t> palette;
+    uint32_t dataOffset;  // Offset of the pixel data in the source
+
+    // Sequential reader over the source
+    uint8_t chunk [CSEUI_SOURCE_CHUNK_SIZE];
+    uint32_t chunkOffset; // Source offset of the next chunk
+    uint16_t chunkPos;
+    uint16_t chunkLength;
+
+    // RLE state, kept across strips
+    uint8_t runLength;
+    bool runRepeat;
+    uint16_t runColor;
+
+    // Strip buffer, allocated on the first draw or set by the caller
+    uint16_t* stripBuffer;
+    uint32_t stripBufferSize; // In pixels
+    bool stripBufferOwned;  // Allocated by the image, and freed by it
+
+    int readByte();
+    uint16_t readPixel();
+    void decodeStrip (uint16_t* buffer, uint32_t count);
+    void freeStripBuffer();
+
+  public:
+    int imageX;
+    int imageY;
+    uint16_t imageWidth;
+    uint16_t imageHeight;
+    uint8_t imageFormat;
+    uint16_t stripHeight; // Rows decoded and pushed at once
+    bool imageVisible;
+    bool stateChanged;
+    uint32_t decodeTime;  // Time spent decoding in the last draw, in microseconds
+    uint32_t pushTime;  // Time spent pushing to the LCD in the last draw, in microseconds
+
+    imageClass (CSE_UI* ui);
+    ~imageClass();
+    bool initialize (int x, int y, byteSourceClass* src, uint16_t strip = CSEUI_IMAGE_DEF_STRIP_HEIGHT);
+    void setStripBuffer (uint16_t* buffer, uint32_t pixels);
+    void draw();
+    void reset();
+    void invalidate();
+    bool getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h);
+    bool isDirty();
+    void show();
+    void hide();
+};
+
 //============================================================================================//
 /**
  * @brief Class for creating a pagination indicator as "currentValue/maxValue".
@@ -369,7 +1698,7 @@ class textAreaClass {
  * uses the buttonClass to create UI element.
  * 
  */
-class paginationClass {
+class paginationClass : public widgetClass {
   private:
     CSE_UI* uiParent;
   public:
@@ -378,6 +1707,11 @@ class paginationClass {
     int maxValue; // The maximum value (last value) of the pagination indicator
     int currentValue; // The current value of the pagination indicator
 
+  private:
+    void updateLabel();
+
+  public:
+
     // Function descriptions can be found in the .cpp file
     paginationClass (CSE_UI* ui);
     void initialize (int x, int y, int w, int h, int max, uint16_t flcolor, uint16_t lbcolor, uint16_t brcolor);
@@ -395,9 +1729,135 @@ class paginationClass {
     void increment();
     void decrement();
     void reset();
+    void invalidate();
+    bool isDirty();
+    bool getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h);
+    bool getOpaqueBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h);
     String getString();
 };
 
+//============================================================================================//
+/**
+ * @brief Animates the change from one page to another. Each frame is composed a strip of
+ * rows at a time: both pages are drawn into small strip sprites with the UI origin set to
+ * the strip, the strips are combined, and the result is pushed to the LCD. No full-screen
+ * buffer is needed, and the LCD never shows a half-drawn page.
+ * 
+ * The position of each frame is taken from the elapsed time, so if the LCD can not keep
+ * up with the target frame rate, frames are skipped and the transition still takes the
+ * given time.
+ * 
+ */
+class transitionClass {
+  private:
+    CSE_UI* uiParent;
+    TFT_eSprite* stripOut;  // Strip of the old page; also holds the composed strip
+    TFT_eSprite* stripIn; // Strip of the new page
+    int16_t screenWidth;
+    int16_t screenHeight;
+
+    void renderPage (pageClass* page, TFT_eSprite* strip, int16_t pageX, int16_t pageY, int16_t top);
+    void drawFrame (pageClass* from, pageClass* to, uint8_t type, uint16_t progress);
+
+  public:
+    uint16_t stripHeight;
+    uint8_t targetFps;  // Frames per second to aim for
+    uint32_t framesDrawn; // Frames drawn in the last transition
+    uint32_t framesSkipped; // Frames dropped in the last transition to keep its duration
+    uint32_t runTime; // Length of the last transition in microseconds
+
+    transitionClass (CSE_UI* ui);
+    ~transitionClass();
+    bool begin (uint16_t strip = CSEUI_TRANSITION_DEF_STRIP_HEIGHT);
+    void end();
+    bool run (pageClass* from, pageClass* to, uint8_t type, uint16_t duration = CSEUI_TRANSITION_DEF_DURATION);
+    float getFps();
+    void printStats (Print& out);
+};
+
+//============================================================================================//
+/**
+ * @brief Creates the widgets of a page from a screen file, as compiled by
+ * tools/screen2bin.py, into an arena. The file is read through a byte source, so it can
+ * be in flash, in a file or in a partition, and screens can be changed without
+ * recompiling the sketch.
+ * 
+ * A screen file has a CSEUI_SCREEN_HEADER_SIZE byte header ("CSU", the version, the page
+ * count, the style count and the string count), then the page directory, the styles, the
+ * string offsets, the strings and the widget records. See docs/Manual.md for the layout.
+ * 
+ */
+class screenLoaderClass {
+  private:
+    CSE_UI* uiParent;
+    byteSourceClass* source;
+
+    bool readBytes (uint32_t offset, uint8_t* buffer, size_t length);
+    bool findPage (int pageNum, uint8_t* entry);
+    void readStyle (uint8_t index, uint16_t* colors);
+    uint16_t readExtra (uint32_t offset, uint16_t index);
+    widgetClass* createWidget (const uint8_t* record, uint32_t extraOffset, arenaClass* arena);
+
+  public:
+    uint8_t pageCount;
+    uint8_t styleCount;
+    uint16_t stringCount;
+
+    screenLoaderClass (CSE_UI* ui);
+    bool begin (byteSourceClass* src);
+    bool getString (uint16_t id, String& str);
+    size_t getArenaSize (int pageNum);
+    bool loadPage (pageClass* page, arenaClass* arena);
+};
+
+//============================================================================================//
+/**
+ * @brief A modal dialog with a title, a message and one or two buttons. When opened, the
+ * region it covers is saved with readRect() if the LCD can be read back, and pushed back
+ * on close. Otherwise, only the widgets under the dialog are redrawn on close.
+ * 
+ * While the dialog is open, touches go to its buttons only, gestures are dropped, and the
+ * widgets of the shown page are drawn around it, as if it were an opaque widget above them.
+ * 
+ */
+class dialogClass : public widgetClass {
+  private:
+    CSE_UI* uiParent;
+    uint16_t* saveBuffer; // Pixels under the dialog, or NULL
+    bool stateChanged;
+
+    void restoreCovered();
+
+  public:
+    int16_t dialogX;
+    int16_t dialogY;
+    int16_t dialogWidth;
+    int16_t dialogHeight;
+    uint16_t dialogFgColor; // Color of the title and the message
+    uint16_t dialogBgColor;
+    uint16_t dialogBorderColor;
+    String title;
+    String message; // Lines are separated by '\n'
+    buttonClass okButton;
+    buttonClass cancelButton; // Not shown if its label is empty
+    bool dialogOpen;
+    bool saveEnabled; // Save the covered region with readRect(), if the LCD can be read
+    bool saveStale; // A widget under the dialog was drawn since it opened; the saved region is out of date
+
+    dialogClass (CSE_UI* ui);
+    ~dialogClass();
+    void initialize (int16_t x, int16_t y, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor, const String& okLabel, const String& cancelLabel = "");
+    bool open();
+    void close();
+    void draw();
+    void invalidate();
+    bool isDirty();
+    bool getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h);
+    bool overlaps (int16_t x, int16_t y, int16_t w, int16_t h);
+    bool ownsWidget (void* widget);
+    uint8_t getResult();
+};
+
 //============================================================================================//
 
 #endif // CSE_UI_LIBRARY
@@ -0,0 +1,368 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Alloc.cpp
+  Description: Allocation tracker source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 03:04:12 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+#if defined(CSEUI_ENABLE_ALLOC_TRACKING)
+  #include <new>
+  #if defined(ARDUINO_ARCH_ESP32)
+    #include "esp_heap_caps.h"
+  #endif
+#endif
+
+//============================================================================================//
+/**
+ * @brief Prints the allocation statistics. Without CSEUI_ENABLE_ALLOC_TRACKING, only a
+ * note is printed.
+ * 
+ * @param out The output, such as Serial.
+ */
+void CSE_UI:: printAllocations (Print& out) {
+#if defined(CSEUI_ENABLE_ALLOC_TRACKING)
+  allocTracker.print (out);
+#else
+  out.println (F("CSEUI_ALLOC disabled; define CSEUI_ENABLE_ALLOC_TRACKING"));
+#endif
+}
+
+//============================================================================================//
+
+#if defined(CSEUI_ENABLE_ALLOC_TRACKING)
+
+//============================================================================================//
+
+#if defined(ARDUINO_ARCH_AVR)
+volatile uint32_t allocTrackerClass:: allocs = 0;
+volatile uint32_t allocTrackerClass:: bytes = 0;
+volatile uint32_t allocTrackerClass:: frees = 0;
+#else
+// Constant-initialized, so they are ready for allocations made before main()
+std::atomic <uint32_t> allocTrackerClass:: allocs (0);
+std::atomic <uint32_t> allocTrackerClass:: bytes (0);
+std::atomic <uint32_t> allocTrackerClass:: frees (0);
+#endif
+
+//============================================================================================//
+
+allocTrackerClass:: allocTrackerClass() {
+  assertEnabled = false;
+  warmupFrames = 0;
+  failHandler = NULL;
+  reset();
+}
+
+//============================================================================================//
+/**
+ * @brief Counts one allocation. Called by the allocation hooks; it must not allocate.
+ * 
+ * @param size Requested size in bytes.
+ */
+void allocTrackerClass:: recordAlloc (size_t size) {
+#if defined(ARDUINO_ARCH_AVR)
+  uint8_t oldSREG = SREG; // malloc() can be called from an interrupt
+  cli();
+  allocs = allocs + 1;
+  bytes = bytes + size;
+  SREG = oldSREG;
+#else
+  allocs.fetch_add (1, std::memory_order_relaxed);
+  bytes.fetch_add ((uint32_t) size, std::memory_order_relaxed);
+#endif
+}
+
+//============================================================================================//
+/**
+ * @brief Counts one free. Called by the allocation hooks.
+ * 
+ */
+void allocTrackerClass:: recordFree() {
+#if defined(ARDUINO_ARCH_AVR)
+  uint8_t oldSREG = SREG;
+  cli();
+  frees = frees + 1;
+  SREG = oldSREG;
+#else
+  frees.fetch_add (1, std::memory_order_relaxed);
+#endif
+}
+
+//============================================================================================//
+/**
+ * @brief Clears all records and frame statistics. The global counters keep running.
+ * 
+ */
+void allocTrackerClass:: reset() {
+  recordCount = 0;
+  frameStartAllocs = allocs;
+  frameStartBytes = bytes;
+  frames = 0;
+  frameAllocs = 0;
+  frameBytes = 0;
+  maxFrameAllocs = 0;
+  maxFrameBytes = 0;
+  allocatingFrames = 0;
+  failures = 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Finds the record of a widget, adding one if needed.
+ * 
+ * @param widget The widget instance.
+ * @param type Widget type name.
+ * @return widgetRecord* The record, or NULL if the table is full.
+ */
+allocTrackerClass::widgetRecord* allocTrackerClass:: find (const void* widget, const char* type) {
+  for (int i = 0; i < recordCount; i++) {
+    if (records [i].widget == widget) {
+      return &records [i];
+    }
+  }
+
+  if (recordCount >= CSEUI_ALLOC_MAX_WIDGETS) {
+    return NULL;
+  }
+
+  widgetRecord* r = &records [recordCount++];
+  r->widget = widget;
+  r->type = type;
+  r->draws = 0;
+  r->allocs = 0;
+  r->bytes = 0;
+  return r;
+}
+
+//============================================================================================//
+
+void allocTrackerClass:: beginFrame() {
+  frameStartAllocs = allocs;
+  frameStartBytes = bytes;
+}
+
+//============================================================================================//
+/**
+ * @brief Updates the frame statistics. If asserting, a frame that allocated after the
+ * warm-up frames is counted as a failure and reported to the fail handler.
+ * 
+ */
+void allocTrackerClass:: endFrame() {
+  frameAllocs = allocs - frameStartAllocs;
+  frameBytes = bytes - frameStartBytes;
+  frames++;
+
+  if (frameAllocs > maxFrameAllocs) maxFrameAllocs = frameAllocs;
+  if (frameBytes > maxFrameBytes) maxFrameBytes = frameBytes;
+
+  if (frameAllocs > 0) {
+    allocatingFrames++;
+
+    if (assertEnabled && (frames > warmupFrames)) {
+      failures++;
+      if (failHandler != NULL) {
+        failHandler (frames, frameAllocs, frameBytes);
+      }
+    }
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Starts treating every allocating frame as a failure. The first frames usually
+ * allocate the widget buffers, so they can be skipped with the warm-up count.
+ * 
+ * @param warmup Number of frames, counted from the last reset(), that may allocate.
+ * @param handler Function called for every failing frame, or NULL to only count them.
+ */
+void allocTrackerClass:: enableAssert (uint32_t warmup, failFuncPtr handler) {
+  assertEnabled = true;
+  warmupFrames = warmup;
+  failHandler = handler;
+}
+
+//============================================================================================//
+
+void allocTrackerClass:: disableAssert() {
+  assertEnabled = false;
+}
+
+//============================================================================================//
+/**
+ * @brief Prints the frame statistics and the allocations of each widget that allocated.
+ * 
+ *   CSEUI_ALLOC frames=<n> allocating_frames=<n> failures=<n> last_allocs=<n> last_bytes=<n> max_allocs=<n> max_bytes=<n>
+ *   CSEUI_ALLOC_WIDGET <type> 0x<widget> draws=<n> allocs=<n> bytes=<n>
+ * 
+ * On ESP32, the free heap and its low-water mark are printed as well.
+ * 
+ * @param out The output, such as Serial.
+ */
+void allocTrackerClass:: print (Print& out) {
+  out.print (F("CSEUI_ALLOC frames="));
+  out.print (frames);
+  out.print (F(" allocating_frames="));
+  out.print (allocatingFrames);
+  out.print (F(" failures="));
+  out.print (failures);
+  out.print (F(" last_allocs="));
+  out.print (frameAllocs);
+  out.print (F(" last_bytes="));
+  out.print (frameBytes);
+  out.print (F(" max_allocs="));
+  out.print (maxFrameAllocs);
+  out.print (F(" max_bytes="));
+  out.println (maxFrameBytes);
+
+#if defined(ARDUINO_ARCH_ESP32)
+  out.print (F("CSEUI_ALLOC_HEAP free="));
+  out.print ((unsigned long) heap_caps_get_free_size (MALLOC_CAP_8BIT));
+  out.print (F(" min_free="));
+  out.println ((unsigned long) heap_caps_get_minimum_free_size (MALLOC_CAP_8BIT));
+#endif
+
+  for (int i = 0; i < recordCount; i++) {
+    const widgetRecord& r = records [i];
+
+    if (r.allocs == 0) continue;
+
+    out.print (F("CSEUI_ALLOC_WIDGET "));
+    out.print (r.type);
+    out.print (F(" 0x"));
+    out.print ((unsigned long) (uintptr_t) r.widget, HEX);
+    out.print (F(" draws="));
+    out.print (r.draws);
+    out.print (F(" allocs="));
+    out.print (r.allocs);
+    out.print (F(" bytes="));
+    out.println (r.bytes);
+  }
+}
+
+//============================================================================================//
+
+allocTrackerClass::scope:: scope (allocTrackerClass* t, const void* widget, const char* type) {
+  record = t->find (widget, type);
+  startAllocs = allocs;
+  startBytes = bytes;
+}
+
+//============================================================================================//
+
+allocTrackerClass::scope:: ~scope() {
+  if (record != NULL) {
+    record->draws++;
+    record->allocs += allocs - startAllocs;
+    record->bytes += bytes - startBytes;
+  }
+}
+
+//============================================================================================//
+// Allocation hooks
+
+#if defined(CSEUI_ALLOC_WRAP_MALLOC)
+
+// The linker redirects malloc() and friends here when --wrap is used. The C++ operators
+// end up in malloc() as well, so they are counted too.
+extern "C" {
+  void* __real_malloc (size_t size);
+  void* __real_calloc (size_t count, size_t size);
+  void* __real_realloc (void* ptr, size_t size);
+  void __real_free (void* ptr);
+
+  void* __wrap_malloc (size_t size) {
+    allocTrackerClass::recordAlloc (size);
+    return __real_malloc (size);
+  }
+
+  void* __wrap_calloc (size_t count, size_t size) {
+    allocTrackerClass::recordAlloc (count * size);
+    return __real_calloc (count, size);
+  }
+
+  void* __wrap_realloc (void* ptr, size_t size) {
+    if (size > 0) {
+      allocTrackerClass::recordAlloc (size);
+    }
+    if (ptr != NULL) {
+      allocTrackerClass::recordFree();
+    }
+    return __real_realloc (ptr, size);
+  }
+
+  void __wrap_free (void* ptr) {
+    if (ptr != NULL) {
+      allocTrackerClass::recordFree();
+    }
+    __real_free (ptr);
+  }
+}
+
+#elif !defined(ARDUINO_ARCH_AVR) // The AVR core defines its own operators that can not be replaced
+
+void* operator new (size_t size) {
+  allocTrackerClass::recordAlloc (size);
+  void* ptr = malloc (size > 0 ? size : 1);
+
+#if defined(__cpp_exceptions)
+  if (ptr == NULL) throw std::bad_alloc();
+#endif
+  return ptr;
+}
+
+void* operator new[] (size_t size) {
+  return operator new (size);
+}
+
+void* operator new (size_t size, const std::nothrow_t&) noexcept {
+  allocTrackerClass::recordAlloc (size);
+  return malloc (size > 0 ? size : 1);
+}
+
+void* operator new[] (size_t size, const std::nothrow_t& tag) noexcept {
+  return operator new (size, tag);
+}
+
+void operator delete (void* ptr) noexcept {
+  if (ptr != NULL) {
+    allocTrackerClass::recordFree();
+    free (ptr);
+  }
+}
+
+void operator delete[] (void* ptr) noexcept {
+  operator delete (ptr);
+}
+
+void operator delete (void* ptr, const std::nothrow_t&) noexcept {
+  operator delete (ptr);
+}
+
+void operator delete[] (void* ptr, const std::nothrow_t&) noexcept {
+  operator delete (ptr);
+}
+
+#if defined(__cpp_sized_deallocation)
+void operator delete (void* ptr, size_t) noexcept {
+  operator delete (ptr);
+}
+
+void operator delete[] (void* ptr, size_t) noexcept {
+  operator delete (ptr);
+}
+#endif
+
+#endif // CSEUI_ALLOC_WRAP_MALLOC
+
+//============================================================================================//
+
+#endif // CSEUI_ENABLE_ALLOC_TRACKING
@@ -0,0 +1,147 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Arena.cpp
+  Description: Arena allocator source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 04:44:52 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+
+arenaClass:: arenaClass() {
+  buffer = NULL;
+  ownsBuffer = false;
+  destructors = NULL;
+  capacity = 0;
+  used = 0;
+  peak = 0;
+  failures = 0;
+}
+
+//============================================================================================//
+
+arenaClass:: ~arenaClass() {
+  end();
+}
+
+//============================================================================================//
+/**
+ * @brief Allocates the arena buffer from the heap. This is the only heap allocation of the
+ * arena.
+ * 
+ * @param size Size of the arena in bytes.
+ * @return true The buffer was allocated.
+ * @return false Not enough memory.
+ */
+bool arenaClass:: begin (size_t size) {
+  end();
+
+  buffer = (uint8_t*) malloc (size);
+
+  if (buffer == NULL) return false;
+
+  ownsBuffer = true;
+  capacity = size;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Uses a buffer given by the application, such as a static array.
+ * 
+ * @param buf The buffer. It should be aligned to CSEUI_ARENA_ALIGN bytes.
+ * @param size Size of the buffer in bytes.
+ * @return true The buffer was set.
+ * @return false The buffer is NULL.
+ */
+bool arenaClass:: begin (void* buf, size_t size) {
+  end();
+
+  if (buf == NULL) return false;
+
+  buffer = (uint8_t*) buf;
+  ownsBuffer = false;
+  capacity = size;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Destroys all objects and frees the buffer if it was allocated by the arena.
+ * 
+ */
+void arenaClass:: end() {
+  reset();
+
+  if (ownsBuffer && (buffer != NULL)) {
+    free (buffer);
+  }
+
+  buffer = NULL;
+  ownsBuffer = false;
+  capacity = 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Allocates a block from the arena. Blocks are aligned to CSEUI_ARENA_ALIGN bytes
+ * and can not be freed individually.
+ * 
+ * @param size Size of the block in bytes.
+ * @return void* The block, or NULL if the arena is full.
+ */
+void* arenaClass:: allocate (size_t size) {
+  size = alignSize (size);
+
+  if ((buffer == NULL) || (size > (capacity - used))) {
+    failures++;
+    return NULL;
+  }
+
+  void* block = buffer + used;
+  used += size;
+
+  if (used > peak) {
+    peak = used;
+  }
+  return block;
+}
+
+//============================================================================================//
+/**
+ * @brief Destroys the objects created with create(), newest first, and frees the whole
+ * arena at once.
+ * 
+ */
+void arenaClass:: reset() {
+  while (destructors != NULL) {
+    destructorNode* node = destructors;
+    destructors = node->next;
+    node->destroy (node->object);
+  }
+  used = 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Checks if an object lies in the arena buffer, such as a widget created with
+ * create() or a member of one.
+ * 
+ * @param object The object.
+ * @return true 
+ * @return false 
+ */
+bool arenaClass:: contains (const void* object) {
+  const uint8_t* p = (const uint8_t*) object;
+  return (buffer != NULL) && (p >= buffer) && (p < (buffer + capacity));
+}
+
+//============================================================================================//
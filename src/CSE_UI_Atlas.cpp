@@ -0,0 +1,169 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Atlas.cpp
+  Description: Icon atlas source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 11:47:36 AM 20-10-2026, Tuesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+
+iconAtlasClass:: iconAtlasClass (CSE_UI* ui) {
+  uiParent = ui;
+  sheet = NULL;
+  useCounter = 0;
+  cellWidth = 0;
+  cellHeight = 0;
+  hits = 0;
+  misses = 0;
+  evictions = 0;
+}
+
+//============================================================================================//
+
+iconAtlasClass:: ~iconAtlasClass() {
+  end();
+}
+
+//============================================================================================//
+/**
+ * @brief Allocates the sheet. Icons whose glyph bounds are larger than a cell are drawn
+ * directly instead.
+ * 
+ * @param w Width of a cell in pixels.
+ * @param h Height of a cell in pixels.
+ * @param cells Number of cells. Each cell holds one icon in one color combination.
+ * @return true The sheet was allocated.
+ * @return false Not enough memory.
+ */
+bool iconAtlasClass:: begin (uint16_t w, uint16_t h, uint16_t cells) {
+  end();
+
+  size_t bytes = (size_t) w * h * cells * 2;
+
+#if defined(ARDUINO_ARCH_ESP32)
+  sheet = (uint16_t*) heap_caps_malloc (bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);  // PSRAM first
+  if (sheet == NULL) {
+    sheet = (uint16_t*) malloc (bytes);
+  }
+#else
+  sheet = (uint16_t*) malloc (bytes);
+#endif
+
+  if (sheet == NULL) return false;
+
+  cellWidth = w;
+  cellHeight = h;
+  entries.resize (cells);
+  clear();
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Frees the sheet.
+ * 
+ */
+void iconAtlasClass:: end() {
+  if (sheet != NULL) {
+    free (sheet);
+    sheet = NULL;
+  }
+  entries.clear();
+}
+
+//============================================================================================//
+/**
+ * @brief Empties all cells, for example after an icon was changed.
+ * 
+ */
+void iconAtlasClass:: clear() {
+  for (size_t i = 0; i < entries.size(); i++) {
+    entries [i].icon = NULL;
+    entries [i].lastUsed = 0;
+  }
+  useCounter = 0;
+  hits = 0;
+  misses = 0;
+  evictions = 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Draws an icon from the sheet, rasterising it first if it is not there in the
+ * given colors. Only the glyph bounds are pushed, so the background color should be the
+ * color already behind the icon.
+ * 
+ * @param icon The icon.
+ * @param x X coordinate of the icon cell (top-left), as for iconClass:: draw().
+ * @param y Y coordinate of the icon cell (top-left).
+ * @param color Icon color.
+ * @param bgColor Background color.
+ * @return true The icon was drawn.
+ * @return false The atlas is not started or the icon is larger than a cell.
+ */
+bool iconAtlasClass:: draw (iconClass* icon, int16_t x, int16_t y, uint16_t color, uint16_t bgColor) {
+  if ((sheet == NULL) || (icon == NULL)) return false;
+
+  icon->getSize();
+
+  if ((icon->glyphWidth <= 0) || (icon->glyphHeight <= 0)) return true; // Nothing to draw
+  if ((icon->glyphWidth > cellWidth) || (icon->glyphHeight > cellHeight)) return false;
+
+  size_t cell = entries.size();
+  size_t oldest = 0;
+
+  for (size_t i = 0; i < entries.size(); i++) {
+    const atlasEntry& e = entries [i];
+
+    if ((e.icon == icon) && (e.color == color) && (e.bgColor == bgColor)) {
+      cell = i;
+      break;
+    }
+    if (e.lastUsed < entries [oldest].lastUsed) { // Free cells have lastUsed = 0
+      oldest = i;
+    }
+  }
+
+  uint16_t* pixels;
+
+  if (cell < entries.size()) {
+    pixels = sheet + ((size_t) cell * cellWidth * cellHeight);
+    hits++;
+  }
+  else { // Rasterise into the least recently used cell
+    cell = oldest;
+    if (entries [cell].icon != NULL) {
+      evictions++;
+    }
+
+    pixels = sheet + ((size_t) cell * cellWidth * cellHeight);
+    icon->rasterize (pixels, color, bgColor);
+
+    entries [cell].icon = icon;
+    entries [cell].color = color;
+    entries [cell].bgColor = bgColor;
+    misses++;
+  }
+
+  entries [cell].lastUsed = ++useCounter;
+
+  TFT_eSPI* lcd = uiParent->lcdParent;
+  bool swap = lcd->getSwapBytes();
+
+  lcd->setSwapBytes (true); // The sheet holds native RGB565 values
+  lcd->pushImage (x + icon->glyphX, y + icon->glyphY, icon->glyphWidth, icon->glyphHeight, pixels);
+  lcd->setSwapBytes (swap);
+  CSEUI_PROFILE_CALL ((uint32_t) icon->glyphWidth * icon->glyphHeight);
+  return true;
+}
+
+//============================================================================================//
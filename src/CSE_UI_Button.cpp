@@ -9,7 +9,7 @@
   Version: 0.0.8
   License: MIT
   Source: https://github.com/CIRCUITSTATE/CSE_CST328
-  Last Modified: +05:30 01:08:48 AM 02-03-2025, Sunday
+  Last Modified: +05:30 07:52:36 AM 21-10-2026, Wednesday
  */
 //============================================================================================//
 
@@ -25,6 +25,9 @@
  */
 buttonClass:: buttonClass (CSE_UI* ui) {
   uiParent = ui;
+  widgetType = CSEUI_WIDGET_BUTTON;
+  touchId = -1;
+  drawChanged = false;
 }
 
 //============================================================================================//
@@ -41,7 +44,7 @@ buttonClass:: buttonClass (CSE_UI* ui) {
  * @param lbcolor Button label color (foreground color or text color).
  * @param label Button label as a String.
  */
-void buttonClass:: initialize (int16_t x,int16_t y, int16_t w, int16_t h, uint16_t flcolor, uint16_t lbcolor, String label) {
+void buttonClass:: initialize (int16_t x,int16_t y, int16_t w, int16_t h, uint16_t flcolor, uint16_t lbcolor, const String& label) {
   buttonX = x;
   buttonY = y;
   buttonWidth = w;
@@ -59,6 +62,7 @@ void buttonClass:: initialize (int16_t x,int16_t y, int16_t w, int16_t h, uint16
   iconOffsetX = 0;
   iconOffsetY = 0;
   iconAlign = CSEUI_BUTTON_ALIGN_MC;
+  iconFill = -1;
   labelColor = lbcolor;
   labelHoverColor = CSEUI_BUTTON_DEF_LABEL_HOVER_COLOR;
   iconColor = CSEUI_BUTTON_DEF_ICON_COLOR;
@@ -76,6 +80,7 @@ void buttonClass:: initialize (int16_t x,int16_t y, int16_t w, int16_t h, uint16
   iconHoverEnabled = false;
   currentTouchState = false;
   prevTouchState = false;
+  touchId = -1;
   stateChange = true; // So that icon will be drawn the first time
   activeState = false;
 }
@@ -87,12 +92,20 @@ void buttonClass:: initialize (int16_t x,int16_t y, int16_t w, int16_t h, uint16
  * be triggered by updating the label string or touching the button, for example.
  * Parts of the button are drawn accoring to their visibility settings.
  * 
+ * A button that is held keeps its hover colors when it is invalidated.
+ * 
  */
 void buttonClass:: draw() {
+  CSEUI_PROFILE_SCOPE ("button");
+
+  drawChanged = false;
+
   if (buttonVisible) {
-    if (buttonHoverEnabled && (!stateChange) && (buttonEnabled) && isTouched()) {
+    if (buttonHoverEnabled && (buttonEnabled) && (stateChange ? currentTouchState : isTouched())) {
       if (stateChange) { // Only draw if there is a state change
+        drawChanged = true;
         if (fillVisible) {
+          CSEUI_PROFILE_CALL (buttonWidth * buttonHeight);
           if (fillHoverEnabled) {
             if (buttonEnabled) {
               uiParent->lcdParent->fillSmoothRoundRect (buttonX, buttonY, buttonWidth, buttonHeight, radius, fillHoverColor);
@@ -111,6 +124,7 @@ void buttonClass:: draw() {
           }
         }
         if (borderVisible) {
+          CSEUI_PROFILE_CALL (2 * (buttonWidth + buttonHeight));
           if (borderHoverEnabled) {
             if (buttonEnabled) {
               uiParent->lcdParent->drawSmoothRoundRect (buttonX, buttonY, radius, radius-1, buttonWidth, buttonHeight, borderHoverColor);
@@ -132,93 +146,101 @@ void buttonClass:: draw() {
         if (iconVisible) {
           icon->getSize();
 
+          if (fillVisible) { // The atlas needs the color behind the icon
+            iconFill = buttonEnabled ? (fillHoverEnabled ? fillHoverColor : fillColor) : CSEUI_BUTTON_DEACTIVATE_BG_COLOR;
+          }
+          else {
+            iconFill = -1;
+          }
+
           if (iconHoverEnabled) {
             if (iconAlign == CSEUI_BUTTON_ALIGN_TC) { //top center
               if (buttonEnabled) {
-                icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY - icon->glyphY, iconHoverColor);
+                drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY - icon->glyphY, iconHoverColor);
               }
               else {
-                icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+                drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
               }
             }
             else if (iconAlign == CSEUI_BUTTON_ALIGN_RC) { //right center
               if (buttonEnabled) {
-                icon->draw (buttonX + iconOffsetX + (int(buttonWidth - icon->glyphWidth)), buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconHoverColor);
+                drawIcon (buttonX + iconOffsetX + (int(buttonWidth - icon->glyphWidth)), buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconHoverColor);
               }
               else {
-                icon->draw (buttonX + iconOffsetX + (int(buttonWidth - icon->glyphWidth)), buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+                drawIcon (buttonX + iconOffsetX + (int(buttonWidth - icon->glyphWidth)), buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
               }
             }
             else if (iconAlign == CSEUI_BUTTON_ALIGN_BC) { //bottom center
               if (buttonEnabled) {
-                icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int(buttonHeight - icon->glyphHeight)) - icon->glyphY, iconHoverColor);
+                drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int(buttonHeight - icon->glyphHeight)) - icon->glyphY, iconHoverColor);
               }
               else {
-                icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int(buttonHeight - icon->glyphHeight)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+                drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int(buttonHeight - icon->glyphHeight)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
               }
             }
             else if (iconAlign == CSEUI_BUTTON_ALIGN_LC) { //left center
               if (buttonEnabled) {
-                icon->draw (buttonX + iconOffsetX - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconHoverColor);
+                drawIcon (buttonX + iconOffsetX - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconHoverColor);
               }
               else {
-                icon->draw (buttonX + iconOffsetX - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+                drawIcon (buttonX + iconOffsetX - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
               }
             }
             else { //center
               if (buttonEnabled) {
-                icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconHoverColor);
+                drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconHoverColor);
               }
               else {
-                icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+                drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
               }
             }
           }
           else {
             if (iconAlign == CSEUI_BUTTON_ALIGN_TC) { //top center
               if (buttonEnabled) {
-                icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY - icon->glyphY, iconColor);
+                drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY - icon->glyphY, iconColor);
               }
               else {
-                icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+                drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
               }
             }
             else if (iconAlign == CSEUI_BUTTON_ALIGN_RC) { //right center
               if (buttonEnabled) {
-                icon->draw (buttonX + iconOffsetX + (int(buttonWidth - icon->glyphWidth)), buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconColor);
+                drawIcon (buttonX + iconOffsetX + (int(buttonWidth - icon->glyphWidth)), buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconColor);
               }
               else {
-                icon->draw (buttonX + iconOffsetX + (int(buttonWidth - icon->glyphWidth)), buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+                drawIcon (buttonX + iconOffsetX + (int(buttonWidth - icon->glyphWidth)), buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
               }
             }
             else if (iconAlign == CSEUI_BUTTON_ALIGN_BC) { //bottom center
               if (buttonEnabled) {
-                icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int(buttonHeight - icon->glyphHeight)) - icon->glyphY, iconColor);
+                drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int(buttonHeight - icon->glyphHeight)) - icon->glyphY, iconColor);
               }
               else {
-                icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int(buttonHeight - icon->glyphHeight)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+                drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int(buttonHeight - icon->glyphHeight)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
               }
             }
             else if (iconAlign == CSEUI_BUTTON_ALIGN_LC) { //left center
               if (buttonEnabled) {
-                icon->draw (buttonX + iconOffsetX - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconColor);
+                drawIcon (buttonX + iconOffsetX - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconColor);
               }
               else {
-                icon->draw (buttonX + iconOffsetX - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+                drawIcon (buttonX + iconOffsetX - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
               }
             }
             else { //center
               if (buttonEnabled) {
-                icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconColor);
+                drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconColor);
               }
               else {
-                icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+                drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
               }
             }
           }
         }
 
         if (labelVisible) {
+          CSEUI_PROFILE_TEXT (labelString, uiParent->lcdParent->fontHeight());
           // int16_t stringWidth = uiParent->lcdParent->textWidth (labelString);
           
           // Decide the colors for the label
@@ -271,7 +293,9 @@ void buttonClass:: draw() {
 
     else {
       if (stateChange) {
+        drawChanged = true;
         if (fillVisible) {
+          CSEUI_PROFILE_CALL (buttonWidth * buttonHeight);
           if (buttonEnabled) {
             uiParent->lcdParent->fillSmoothRoundRect (buttonX, buttonY, buttonWidth, buttonHeight, radius, fillColor);
           }
@@ -281,6 +305,7 @@ void buttonClass:: draw() {
         }
 
         if (borderVisible) {
+          CSEUI_PROFILE_CALL (2 * (buttonWidth + buttonHeight));
           if (buttonEnabled) {
             uiParent->lcdParent->drawSmoothRoundRect (buttonX, buttonY, radius, radius-1, buttonWidth, buttonHeight, borderColor);
           }
@@ -291,49 +316,52 @@ void buttonClass:: draw() {
 
         if (iconVisible) {
           icon->getSize();
+          iconFill = fillVisible ? (buttonEnabled ? fillColor : CSEUI_BUTTON_DEACTIVATE_BG_COLOR) : -1;
+
           if (iconAlign == CSEUI_BUTTON_ALIGN_TC) { //top center
             if (buttonEnabled) {
-              icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY - icon->glyphY, iconColor);
+              drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY - icon->glyphY, iconColor);
             }
             else {
-              icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+              drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
             }
           }
           else if (iconAlign == CSEUI_BUTTON_ALIGN_RC) { //right center
             if (buttonEnabled) {
-              icon->draw (buttonX + iconOffsetX + (int(buttonWidth - icon->glyphWidth)), buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconColor);
+              drawIcon (buttonX + iconOffsetX + (int(buttonWidth - icon->glyphWidth)), buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconColor);
             }
             else {
-              icon->draw (buttonX + iconOffsetX + (int(buttonWidth - icon->glyphWidth)), buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+              drawIcon (buttonX + iconOffsetX + (int(buttonWidth - icon->glyphWidth)), buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
             }
           }
           else if (iconAlign == CSEUI_BUTTON_ALIGN_BC) { //bottom center
             if (buttonEnabled) {
-              icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int(buttonHeight - icon->glyphHeight)) - icon->glyphY, iconColor);
+              drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int(buttonHeight - icon->glyphHeight)) - icon->glyphY, iconColor);
             }
             else {
-              icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int(buttonHeight - icon->glyphHeight)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+              drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int(buttonHeight - icon->glyphHeight)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
             }
           }
           else if (iconAlign == CSEUI_BUTTON_ALIGN_LC) { //left center
             if (buttonEnabled) {
-              icon->draw (buttonX + iconOffsetX - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconColor);
+              drawIcon (buttonX + iconOffsetX - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconColor);
             }
             else {
-              icon->draw (buttonX + iconOffsetX - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+              drawIcon (buttonX + iconOffsetX - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
             }
           }
           else { //center
             if (buttonEnabled) {
-              icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconColor);
+              drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, iconColor);
             }
             else {
-              icon->draw (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
+              drawIcon (buttonX + iconOffsetX + (int((buttonWidth - icon->glyphWidth)/2)) - icon->glyphX, buttonY + iconOffsetY + (int((buttonHeight - icon->glyphHeight)/2)) - icon->glyphY, CSEUI_BUTTON_DEACTIVATE_FG_COLOR); //no need of bgcolor color
             }
           }
         }
 
         if (labelVisible) {
+          CSEUI_PROFILE_TEXT (labelString, uiParent->lcdParent->fontHeight());
           // Determine the colors of the label
           if (buttonEnabled) { // For functional state
             uiParent->lcdParent->setTextColor (labelColor, fillColor);
@@ -382,32 +410,61 @@ void buttonClass:: draw() {
 
 //============================================================================================//
 /**
- * @brief Check if the button is currently being touched.
+ * @brief Check if the button is currently being touched. Each touch point is routed to
+ * only one widget. Once a finger starts touching the button, the button keeps that
+ * finger until it is lifted or leaves the button (plus the filter hysteresis), and
+ * other fingers can hold other buttons at the same time.
  * 
  * @return true 
  * @return false 
  */
 bool buttonClass:: isTouched() {
-  if (uiParent->tsParent->isTouched (0)) { // Check if lcd is being touched
-    CSE_TouchPoint p = uiParent->tsParent->getPoint(); // Get the touched point
-
-    // Serial.print ("X = ");
-    // Serial.print (p.x);
-    // Serial.print (", Y = ");
-    // Serial.print (p.y);
-    // Serial.print (", Z = ");
-    // Serial.print (p.z);
-    // Serial.print (", Bx = ");
-    // Serial.print (buttonX);
-    // Serial.print (", By = ");
-    // Serial.println (buttonY);
-
-    if ((p.x >= buttonX) && (p.x < (buttonX + buttonWidth)) && (p.y >= buttonY) && (p.y < (buttonY + buttonHeight)) && (p.z >= CSEUI_TOUCH_PRESSURE_THRESHOLD)) {
-      // Serial.println ("Button Touched");
-      stateChange = currentTouchState ? false: true;
-      currentTouchState = true;
-      prevTouchState = true;
-      return true;
+  uiParent->getTouchFrame(); // Make sure the touch snapshot is up to date
+  const CSE_UI_TouchPoint* p = NULL;
+  bool cancelled = false; // The finger left the button without lifting
+
+  if (touchId >= 0) { // Follow the finger that is holding the button
+    p = uiParent->findTouchPoint (touchId);
+
+    if ((p == NULL) || (!contains (p->x, p->y, uiParent->touchFilter.hysteresis)) || (!uiParent->claimTouch (touchId, this))) {
+      cancelled = (p != NULL);
+      uiParent->releaseTouch (touchId, this);
+      touchId = -1;
+      p = NULL;
+    }
+  }
+
+  if (touchId < 0) { // Look for a free finger on the button
+    const CSE_UI_TouchFrame& frame = uiParent->touchFrame;
+
+    for (int i = 0; i < frame.count; i++) {
+      const CSE_UI_TouchPoint& q = frame.points [i];
+
+      if (contains (q.x, q.y) && uiParent->claimTouch (q.id, this)) {
+        touchId = q.id;
+        p = &q;
+        break;
+      }
+    }
+  }
+
+  if (p != NULL) {
+    if (!currentTouchState) {
+      uiParent->postEvent (CSEUI_EVENT_TOUCH, this, p->x, p->y);
+    }
+    stateChange = currentTouchState ? false: true;
+    currentTouchState = true;
+    prevTouchState = true;
+    return true;
+  }
+
+  if (currentTouchState) {
+    if (cancelled) {
+      uiParent->postEvent (CSEUI_EVENT_CANCEL, this, buttonX, buttonY);
+      prevTouchState = false; // Not a press for isPressed() either
+    }
+    else {
+      uiParent->postEvent (CSEUI_EVENT_PRESS, this, buttonX, buttonY);
     }
   }
   stateChange = currentTouchState ? true: false;
@@ -415,6 +472,22 @@ bool buttonClass:: isTouched() {
   return false;
 }
 
+//============================================================================================//
+/**
+ * @brief Check if a point lies inside the button. A margin grows the button on all
+ * sides, and is used to keep a held button from toggling when the finger jitters on
+ * its edge.
+ * 
+ * @param x 
+ * @param y 
+ * @param margin Pixels to grow the button by.
+ * @return true 
+ * @return false 
+ */
+bool buttonClass:: contains (int16_t x, int16_t y, int16_t margin) {
+  return (x >= (buttonX - margin)) && (x < (buttonX + buttonWidth + margin)) && (y >= (buttonY - margin)) && (y < (buttonY + buttonHeight + margin));
+}
+
 //============================================================================================//
 /**
  * @brief Check if the button is pressed once. Pressing the butto requires touching the
@@ -480,10 +553,102 @@ void buttonClass:: enable() {
 void buttonClass:: reset() {
   currentTouchState = false;
   prevTouchState = false;
+
+  if (touchId >= 0) {
+    uiParent->releaseTouch (touchId, this);
+    touchId = -1;
+  }
   stateChange = true;
   // activeState = false;
 }
 
+//============================================================================================//
+/**
+ * @brief Marks the button for a redraw without changing its touch state.
+ * 
+ */
+void buttonClass:: invalidate() {
+  stateChange = true;
+}
+
+//============================================================================================//
+/**
+ * @brief Tells whether draw() would draw anything. Without a state change, a button only
+ * draws when a touch can change its hover state, so the touch snapshot is checked the way
+ * isTouched() does.
+ * 
+ */
+bool buttonClass:: isDirty() {
+  if (!buttonVisible) return false;
+  if (stateChange) return true;
+  if ((!buttonHoverEnabled) || (!buttonEnabled)) return false;
+  if (currentTouchState || (touchId >= 0)) return true; // It may be released
+
+  const CSE_UI_TouchFrame& frame = uiParent->getTouchFrame();
+
+  for (int i = 0; i < frame.count; i++) {
+    if (contains (frame.points [i].x, frame.points [i].y)) return true;
+  }
+  return false;
+}
+
+//============================================================================================//
+
+bool buttonClass:: getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  if (!buttonVisible) return false;
+
+  x = buttonX;
+  y = buttonY;
+  w = buttonWidth;
+  h = buttonHeight;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the part of the button that its fill covers completely. The fill is
+ * solid except for the rounded corners, so the band between the corners is used: across
+ * the full height for buttons wider than they are tall, and across the full width
+ * otherwise. Buttons without a fill cover nothing, unless opaque is set.
+ * 
+ * @return true The area is not empty.
+ * @return false The button is hidden or covers nothing.
+ */
+bool buttonClass:: getOpaqueBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  if (!getBounds (x, y, w, h)) return false;
+  if (opaque) return true;
+  if (!fillVisible) return false;
+
+  int16_t r = radius;
+
+  if (r > (w / 2)) r = w / 2; // As fillSmoothRoundRect() limits it
+  if (r > (h / 2)) r = h / 2;
+
+  if (r > 0) {
+    if (w > h) {
+      x += r;
+      w -= 2 * r;
+    }
+    else {
+      y += r;
+      h -= 2 * r;
+    }
+  }
+  return (w > 0) && (h > 0);
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the area changed by the last draw. A button only draws when its state
+ * changes, so a draw that found no change changed nothing.
+ * 
+ * @return true The last draw redrew the button.
+ * @return false The last draw changed nothing, or the button is hidden.
+ */
+bool buttonClass:: getChangedBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  return drawChanged && getBounds (x, y, w, h);
+}
+
 //============================================================================================//
 /**
  * @brief Clears the button area with a background color.
@@ -679,6 +844,71 @@ void buttonClass:: updateState (bool state) {
   stateChange = state;
 }
 
+//============================================================================================//
+/**
+ * @brief Draws the icon, from the icon atlas of the UI if there is one and the button has
+ * a fill to rasterise the icon against. Alpha icons are blended with the fill.
+ * 
+ * @param x X coordinate of the icon cell (top-left).
+ * @param y Y coordinate of the icon cell (top-left).
+ * @param color Icon color.
+ */
+void buttonClass:: drawIcon (int16_t x, int16_t y, uint16_t color) {
+  if (iconFill < 0) {
+    icon->draw (x, y, color);
+    return;
+  }
+
+  if (uiParent->iconAtlas != NULL) {
+    if (uiParent->iconAtlas->draw (icon, x, y, color, (uint16_t) iconFill)) return;
+  }
+  icon->draw (x, y, color, (uint16_t) iconFill);
+}
+
+//============================================================================================//
+/**
+ * @brief Changes the label and triggers a redraw. Nothing is copied or redrawn if the
+ * label is unchanged. The text is copied into the existing label buffer, so labels of
+ * similar length can be updated without allocating.
+ * 
+ * @param label The new label.
+ * @return true The label was changed.
+ * @return false The label was the same.
+ */
+bool buttonClass:: setLabel (const char* label) {
+  if (labelString == label) return false;
+
+  labelString = label;
+  stateChange = true;
+  return true;
+}
+
+//============================================================================================//
+
+bool buttonClass:: setLabel (const String& label) {
+  if (labelString == label) return false;
+
+  labelString = label;
+  stateChange = true;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Changes the label from a temporary, taking over its buffer instead of copying.
+ * 
+ * @param label The new label.
+ * @return true The label was changed.
+ * @return false The label was the same.
+ */
+bool buttonClass:: setLabel (String&& label) {
+  if (labelString == label) return false;
+
+  labelString = std::move (label);
+  stateChange = true;
+  return true;
+}
+
 //============================================================================================//
 /**
  * @brief Get the current state of the button.
@@ -0,0 +1,272 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Capture.cpp
+  Description: Off-screen capture source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 07:38:12 PM 20-10-2026, Tuesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+
+captureClass:: captureClass (CSE_UI* ui) {
+  uiParent = ui;
+  sprite = NULL;
+  prevTarget = NULL;
+  originX = 0;
+  originY = 0;
+  width = 0;
+  height = 0;
+}
+
+//============================================================================================//
+
+captureClass:: ~captureClass() {
+  end();
+}
+
+//============================================================================================//
+/**
+ * @brief Allocates the capture buffer for a region of the screen. Widgets keep using
+ * their screen coordinates while being captured.
+ * 
+ * @param x X-coordinate of the top-left of the region.
+ * @param y Y-coordinate of the top-left of the region.
+ * @param w Width of the region.
+ * @param h Height of the region.
+ * @return true The buffer was allocated.
+ * @return false Not enough memory.
+ */
+bool captureClass:: begin (int16_t x, int16_t y, int16_t w, int16_t h) {
+  end();
+
+  sprite = new TFT_eSprite (uiParent->lcdParent);
+  sprite->setColorDepth (16);
+
+  if (sprite->createSprite (w, h) == NULL) {
+    delete sprite;
+    sprite = NULL;
+    return false;
+  }
+
+  originX = x;
+  originY = y;
+  width = w;
+  height = h;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Frees the capture buffer.
+ * 
+ */
+void captureClass:: end() {
+  stop();
+
+  if (sprite != NULL) {
+    sprite->deleteSprite();
+    delete sprite;
+    sprite = NULL;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Clears the buffer and redirects all widget drawing into it. Reset the widgets
+ * to be captured and draw them after this, then call stop().
+ * 
+ * @param bgColor Color to clear the buffer with.
+ */
+void captureClass:: start (uint16_t bgColor) {
+  if ((sprite == NULL) || (prevTarget != NULL)) return;
+
+  sprite->resetViewport();
+  sprite->fillSprite (bgColor);
+
+  prevTarget = uiParent->setDrawTarget (sprite);
+  uiParent->setOrigin (originX, originY); // Screen coordinates land inside the buffer
+}
+
+//============================================================================================//
+/**
+ * @brief Restores drawing to the previous target.
+ * 
+ */
+void captureClass:: stop() {
+  if (prevTarget == NULL) return;
+
+  uiParent->setOrigin (0, 0);
+  uiParent->setDrawTarget (prevTarget);
+  prevTarget = NULL;
+}
+
+//============================================================================================//
+/**
+ * @brief Returns a captured pixel in RGB565.
+ * 
+ * @param x X-coordinate inside the capture.
+ * @param y Y-coordinate inside the capture.
+ * @return uint16_t 
+ */
+uint16_t captureClass:: getPixel (int16_t x, int16_t y) {
+  if (sprite == NULL) return 0;
+  return sprite->readPixel (x, y);
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the CRC-32 of the captured pixels (RGB565, row by row, low byte first).
+ * Storing only the checksum of a reference scene is enough to detect any change.
+ * 
+ * @return uint32_t 
+ */
+uint32_t captureClass:: checksum() {
+  uint32_t crc = 0xFFFFFFFF;
+
+  for (int16_t y = 0; y < height; y++) {
+    for (int16_t x = 0; x < width; x++) {
+      uint16_t c = getPixel (x, y);
+      uint8_t bytes [2] = {(uint8_t) (c & 0xFF), (uint8_t) (c >> 8)};
+
+      for (int b = 0; b < 2; b++) {
+        crc ^= bytes [b];
+        for (int k = 0; k < 8; k++) {
+          crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+      }
+    }
+  }
+  return ~crc;
+}
+
+//============================================================================================//
+/**
+ * @brief Compares the capture with a reference image.
+ * 
+ * @param reference RGB565 pixels of the same size, row by row.
+ * @return uint32_t Number of pixels that differ. 0 means the images are identical.
+ */
+uint32_t captureClass:: compare (const uint16_t* reference) {
+  uint32_t diff = 0;
+
+  for (int16_t y = 0; y < height; y++) {
+    for (int16_t x = 0; x < width; x++) {
+      if (getPixel (x, y) != reference [(uint32_t) y * width + x]) {
+        diff++;
+      }
+    }
+  }
+  return diff;
+}
+
+//============================================================================================//
+/**
+ * @brief Writes the captured pixels as raw RGB565, row by row, low byte first. This is
+ * the format compare() expects for reference images.
+ * 
+ * @param out The output, such as a File.
+ */
+void captureClass:: writeRaw (Print& out) {
+  for (int16_t y = 0; y < height; y++) {
+    for (int16_t x = 0; x < width; x++) {
+      uint16_t c = getPixel (x, y);
+      out.write ((uint8_t) (c & 0xFF));
+      out.write ((uint8_t) (c >> 8));
+    }
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Writes the header of a 24-bit bottom-up BMP file of the capture size.
+ * 
+ * @param out 
+ */
+void captureClass:: writeBMPHeader (Print& out) {
+  uint32_t rowSize = ((uint32_t) width * 3 + 3) & ~3UL;
+  uint32_t imageSize = rowSize * height;
+  uint32_t fileSize = 54 + imageSize;
+
+  uint8_t header [54] = {
+    'B', 'M',
+    (uint8_t) fileSize, (uint8_t) (fileSize >> 8), (uint8_t) (fileSize >> 16), (uint8_t) (fileSize >> 24),
+    0, 0, 0, 0,
+    54, 0, 0, 0,  // Pixel data offset
+    40, 0, 0, 0,  // Info header size
+    (uint8_t) width, (uint8_t) (width >> 8), 0, 0,
+    (uint8_t) height, (uint8_t) (height >> 8), 0, 0,
+    1, 0, // Planes
+    24, 0,  // Bits per pixel
+    0, 0, 0, 0, // No compression
+    (uint8_t) imageSize, (uint8_t) (imageSize >> 8), (uint8_t) (imageSize >> 16), (uint8_t) (imageSize >> 24),
+    0x13, 0x0B, 0, 0, // 72 DPI
+    0x13, 0x0B, 0, 0,
+    0, 0, 0, 0,
+    0, 0, 0, 0
+  };
+
+  out.write (header, 54);
+}
+
+//============================================================================================//
+/**
+ * @brief Writes the capture as a 24-bit BMP image.
+ * 
+ * @param out The output, such as a File.
+ */
+void captureClass:: writeBMP (Print& out) {
+  writeDiffBMP (NULL, out);
+}
+
+//============================================================================================//
+/**
+ * @brief Writes a 24-bit BMP image that shows where the capture differs from a
+ * reference. Differing pixels are red, matching pixels are a dimmed grey version of
+ * the capture. If reference is NULL, the plain capture is written.
+ * 
+ * @param reference RGB565 pixels of the same size, or NULL.
+ * @param out The output, such as a File.
+ */
+void captureClass:: writeDiffBMP (const uint16_t* reference, Print& out) {
+  writeBMPHeader (out);
+
+  uint8_t padding = (4 - ((width * 3) % 4)) % 4;
+
+  for (int16_t y = height - 1; y >= 0; y--) { // BMP rows are stored bottom-up
+    for (int16_t x = 0; x < width; x++) {
+      uint16_t c = getPixel (x, y);
+      uint8_t r = ((c >> 11) & 0x1F) << 3;
+      uint8_t g = ((c >> 5) & 0x3F) << 2;
+      uint8_t b = (c & 0x1F) << 3;
+
+      if (reference != NULL) {
+        if (c != reference [(uint32_t) y * width + x]) {
+          r = 255;
+          g = 0;
+          b = 0;
+        }
+        else {
+          uint8_t grey = (((uint16_t) r + g + b) / 3) / 3 + 64;
+          r = g = b = grey;
+        }
+      }
+
+      out.write (b);
+      out.write (g);
+      out.write (r);
+    }
+    for (uint8_t p = 0; p < padding; p++) {
+      out.write ((uint8_t) 0);
+    }
+  }
+}
+
+//============================================================================================//
@@ -0,0 +1,326 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Dialog.cpp
+  Description: Modal dialog source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 08:31:57 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+
+dialogClass:: dialogClass (CSE_UI* ui) : okButton (ui), cancelButton (ui) {
+  uiParent = ui;
+  widgetType = CSEUI_WIDGET_DIALOG;
+  opaque = true;
+  saveBuffer = NULL;
+  saveStale = false;
+  stateChanged = false;
+  dialogX = 0;
+  dialogY = 0;
+  dialogWidth = 0;
+  dialogHeight = 0;
+  dialogFgColor = TFT_WHITE;
+  dialogBgColor = TFT_BLACK;
+  dialogBorderColor = CSEUI_DIALOG_DEF_BORDER_COLOR;
+  dialogOpen = false;
+  saveEnabled = true;
+}
+
+//============================================================================================//
+
+dialogClass:: ~dialogClass() {
+  close();
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the position and colors of the dialog and lays out its buttons along the
+ * bottom edge. Set the title and message before opening the dialog.
+ * 
+ * @param x X-coordinate of the top-left of the dialog.
+ * @param y Y-coordinate of the top-left of the dialog.
+ * @param w Width of the dialog in pixels.
+ * @param h Height of the dialog in pixels.
+ * @param fgcolor Color of the text, and the fill of the buttons.
+ * @param bgcolor Fill color of the dialog, and the label color of the buttons.
+ * @param okLabel Label of the OK button.
+ * @param cancelLabel Label of the cancel button. The button is not shown if this is empty.
+ */
+void dialogClass:: initialize (int16_t x, int16_t y, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor, const String& okLabel, const String& cancelLabel) {
+  dialogX = x;
+  dialogY = y;
+  dialogWidth = w;
+  dialogHeight = h;
+  dialogFgColor = fgcolor;
+  dialogBgColor = bgcolor;
+
+  int16_t buttonWidth = (w - (3 * CSEUI_DIALOG_MARGIN)) / 2;
+  int16_t buttonY = y + h - CSEUI_DIALOG_MARGIN - CSEUI_DIALOG_BUTTON_HEIGHT;
+
+  if (cancelLabel.length() > 0) {
+    cancelButton.initialize (x + CSEUI_DIALOG_MARGIN, buttonY, buttonWidth, CSEUI_DIALOG_BUTTON_HEIGHT, fgcolor, bgcolor, cancelLabel);
+    okButton.initialize (x + w - CSEUI_DIALOG_MARGIN - buttonWidth, buttonY, buttonWidth, CSEUI_DIALOG_BUTTON_HEIGHT, fgcolor, bgcolor, okLabel);
+  }
+  else {
+    cancelButton.initialize (0, 0, 0, 0, fgcolor, bgcolor, "");
+    okButton.initialize (x + ((w - buttonWidth) / 2), buttonY, buttonWidth, CSEUI_DIALOG_BUTTON_HEIGHT, fgcolor, bgcolor, okLabel);
+  }
+
+  stateChanged = true;
+}
+
+//============================================================================================//
+/**
+ * @brief Opens the dialog over the shown page. The region under the dialog is saved first
+ * if saveEnabled is true, the LCD can be read back, and there is memory for it. On ESP32,
+ * the buffer is placed in PSRAM if available. The dialog is drawn by the next draw of the
+ * page, or by calling draw().
+ * 
+ * Only one dialog can be open at a time.
+ * 
+ * @return true The dialog is open.
+ * @return false Another dialog is open.
+ */
+bool dialogClass:: open() {
+  if (dialogOpen) return true;
+  if (uiParent->modalDialog != NULL) return false;
+
+#if CSEUI_LCD_READABLE
+  if (saveEnabled) {
+    size_t bytes = (size_t) dialogWidth * dialogHeight * 2;
+
+  #if defined(ARDUINO_ARCH_ESP32)
+    saveBuffer = (uint16_t*) heap_caps_malloc (bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);  // PSRAM first
+    if (saveBuffer == NULL) {
+      saveBuffer = (uint16_t*) malloc (bytes);
+    }
+  #else
+    saveBuffer = (uint16_t*) malloc (bytes);
+  #endif
+
+    if (saveBuffer != NULL) {
+      uiParent->lcdParent->readRect (dialogX, dialogY, dialogWidth, dialogHeight, saveBuffer);
+    }
+  }
+#endif
+
+  // Touches from before the dialog must not press its buttons
+  okButton.prevTouchState = false;
+  okButton.currentTouchState = false;
+  cancelButton.prevTouchState = false;
+  cancelButton.currentTouchState = false;
+
+  dialogOpen = true;
+  saveStale = false;
+  stateChanged = true;
+  uiParent->modalDialog = this;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Closes the dialog. The saved region is pushed back if there is one and no widget
+ * under the dialog was drawn while it was open. Otherwise the area is filled with the page
+ * background, if the page has one, and the widgets under the dialog are redrawn in the
+ * next draw of the page.
+ * 
+ */
+void dialogClass:: close() {
+  if (!dialogOpen) return;
+
+  dialogOpen = false;
+
+  if (uiParent->modalDialog == this) {
+    uiParent->modalDialog = NULL;
+  }
+
+  if (okButton.touchId >= 0) {
+    uiParent->releaseTouch (okButton.touchId, &okButton);
+    okButton.touchId = -1;
+  }
+
+  if (cancelButton.touchId >= 0) {
+    uiParent->releaseTouch (cancelButton.touchId, &cancelButton);
+    cancelButton.touchId = -1;
+  }
+
+  if ((saveBuffer != NULL) && (!saveStale)) {
+    uiParent->lcdParent->pushRect (dialogX, dialogY, dialogWidth, dialogHeight, saveBuffer); // Not byte-swapped, as read
+    CSEUI_PROFILE_CALL ((uint32_t) dialogWidth * dialogHeight);
+  }
+  else {
+    restoreCovered();
+  }
+
+  if (saveBuffer != NULL) {
+    free (saveBuffer);
+    saveBuffer = NULL;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Redraws the region under the dialog from the shown page, when it could not be
+ * saved. Only the widgets that overlap the dialog are invalidated.
+ * 
+ */
+void dialogClass:: restoreCovered() {
+  pageClass* page = uiParent->activePage;
+
+  if (page == NULL) return;
+
+  if (page->bgColor >= 0) {
+    uiParent->lcdParent->fillRect (dialogX, dialogY, dialogWidth, dialogHeight, (uint16_t) page->bgColor);
+    CSEUI_PROFILE_CALL ((uint32_t) dialogWidth * dialogHeight);
+  }
+
+  page->invalidateArea (dialogX, dialogY, dialogWidth, dialogHeight);
+}
+
+//============================================================================================//
+/**
+ * @brief Draws the dialog if it is open. The frame and the text are drawn only when the
+ * dialog opens or is invalidated; the buttons are drawn on every call so they follow the
+ * touches.
+ * 
+ */
+void dialogClass:: draw() {
+  CSEUI_PROFILE_SCOPE ("dialog");
+
+  if (!dialogOpen) return;
+
+  TFT_eSPI* lcd = uiParent->lcdParent;
+
+  if (stateChanged) {
+    lcd->fillRect (dialogX, dialogY, dialogWidth, dialogHeight, dialogBgColor);
+    lcd->drawRect (dialogX, dialogY, dialogWidth, dialogHeight, dialogBorderColor);
+    CSEUI_PROFILE_CALL ((uint32_t) dialogWidth * dialogHeight);
+
+    uint8_t prevDatum = lcd->getTextDatum();
+    int16_t lineHeight = lcd->fontHeight();
+    int16_t centerX = dialogX + (dialogWidth / 2);
+    int16_t top = dialogY + CSEUI_DIALOG_MARGIN;
+
+    lcd->setTextDatum (TC_DATUM);
+    lcd->setTextColor (dialogFgColor, dialogBgColor);
+
+    if (title.length() > 0) {
+      lcd->drawString (title, centerX, top);
+      top += lineHeight + CSEUI_DIALOG_MARGIN;
+    }
+
+    // The message is centered between the title and the buttons
+    int16_t bottom = okButton.buttonY - CSEUI_DIALOG_MARGIN;
+    int lineCount = 1;
+
+    for (unsigned int i = 0; i < message.length(); i++) {
+      if (message [i] == '\n') lineCount++;
+    }
+
+    int16_t lineY = top + ((bottom - top - (lineCount * lineHeight)) / 2);
+    int start = 0;
+
+    while (start <= (int) message.length()) {
+      int end = message.indexOf ('\n', start);
+
+      if (end < 0) end = message.length();
+      if (end > start) {
+        lcd->drawString (message.substring (start, end), centerX, lineY);
+      }
+
+      lineY += lineHeight;
+      start = end + 1;
+    }
+
+    lcd->setTextDatum (prevDatum);
+
+    okButton.invalidate();
+    cancelButton.invalidate();
+    stateChanged = false;
+  }
+
+  okButton.draw();
+
+  if (cancelButton.labelString.length() > 0) {
+    cancelButton.draw();
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Triggers a full redraw of the dialog.
+ * 
+ */
+void dialogClass:: invalidate() {
+  stateChanged = true;
+}
+
+//============================================================================================//
+
+bool dialogClass:: isDirty() {
+  return dialogOpen; // The buttons follow the touches
+}
+
+//============================================================================================//
+
+bool dialogClass:: getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  if (!dialogOpen) return false;
+
+  x = dialogX;
+  y = dialogY;
+  w = dialogWidth;
+  h = dialogHeight;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Check if a rectangle overlaps the dialog.
+ * 
+ * @param x 
+ * @param y 
+ * @param w 
+ * @param h 
+ * @return true 
+ * @return false 
+ */
+bool dialogClass:: overlaps (int16_t x, int16_t y, int16_t w, int16_t h) {
+  return (x < (dialogX + dialogWidth)) && ((x + w) > dialogX) && (y < (dialogY + dialogHeight)) && ((y + h) > dialogY);
+}
+
+//============================================================================================//
+/**
+ * @brief Check if a widget is part of the dialog. Used to route touches while the dialog
+ * is open.
+ * 
+ * @param widget The widget.
+ * @return true 
+ * @return false 
+ */
+bool dialogClass:: ownsWidget (void* widget) {
+  return (widget == this) || (widget == &okButton) || (widget == &cancelButton);
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the button that was pressed, if any. The dialog stays open; call close()
+ * when done with it.
+ * 
+ * @return uint8_t CSEUI_DIALOG_OK, CSEUI_DIALOG_CANCEL or CSEUI_DIALOG_NONE.
+ */
+uint8_t dialogClass:: getResult() {
+  if (!dialogOpen) return CSEUI_DIALOG_NONE;
+  if (okButton.isPressed()) return CSEUI_DIALOG_OK;
+  if ((cancelButton.labelString.length() > 0) && cancelButton.isPressed()) return CSEUI_DIALOG_CANCEL;
+  return CSEUI_DIALOG_NONE;
+}
+
+//============================================================================================//
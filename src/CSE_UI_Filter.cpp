@@ -0,0 +1,181 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Filter.cpp
+  Description: Touch filter source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 01:41:52 PM 19-10-2026, Monday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+// Returns the median of three values.
+
+static int16_t median3 (int16_t a, int16_t b, int16_t c) {
+  if (a > b) {
+    int16_t t = a;
+    a = b;
+    b = t;
+  }
+  if (b > c) {
+    b = c;
+  }
+  return (a > b) ? a : b;
+}
+
+//============================================================================================//
+
+touchFilterClass:: touchFilterClass() {
+  filterMode = CSEUI_FILTER_NONE;
+  emaWeight = CSEUI_FILTER_DEF_EMA_WEIGHT;
+  pressFrames = 1;
+  releaseFrames = 1;
+  pressureThreshold = CSEUI_TOUCH_PRESSURE_THRESHOLD;
+  hysteresis = 0;
+  reset();
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the smoothing filter.
+ * 
+ * @param mode CSEUI_FILTER_NONE, CSEUI_FILTER_MEDIAN or CSEUI_FILTER_EMA.
+ * @param weight Weight of a new sample for the EMA filter, 1-256. Lower is smoother.
+ */
+void touchFilterClass:: setSmoothing (uint8_t mode, uint16_t weight) {
+  filterMode = mode;
+  emaWeight = (weight < 1) ? 1 : ((weight > 256) ? 256 : weight);
+  reset();
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the press and release debounce.
+ * 
+ * @param press Samples a point must be seen before it is reported. Min. 1.
+ * @param release Samples a point must be missing before it is released. Min. 1.
+ */
+void touchFilterClass:: setDebounce (uint8_t press, uint8_t release) {
+  pressFrames = (press < 1) ? 1 : press;
+  releaseFrames = (release < 1) ? 1 : release;
+  reset();
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the edge hysteresis. A widget held by a finger is only released when the
+ * finger moves this many pixels outside of it.
+ * 
+ * @param pixels 
+ */
+void touchFilterClass:: setHysteresis (int16_t pixels) {
+  hysteresis = (pixels < 0) ? 0 : pixels;
+}
+
+//============================================================================================//
+/**
+ * @brief Clears the state of all touch points.
+ * 
+ */
+void touchFilterClass:: reset() {
+  for (int i = 0; i < CSEUI_TOUCH_MAX_POINTS; i++) {
+    states [i].historyCount = 0;
+    states [i].emaX = 0;
+    states [i].emaY = 0;
+    states [i].pressCount = 0;
+    states [i].releaseCount = 0;
+    states [i].active = false;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Filters a touch frame in place. Call this once for every raw sample, in order.
+ * 
+ * @param frame The raw frame. On return, it holds the filtered points.
+ */
+void touchFilterClass:: apply (CSE_UI_TouchFrame& frame) {
+  bool seen [CSEUI_TOUCH_MAX_POINTS] = {false};
+
+  for (int i = 0; i < frame.count; i++) {
+    const CSE_UI_TouchPoint& p = frame.points [i];
+
+    if ((p.id >= CSEUI_TOUCH_MAX_POINTS) || (p.z < pressureThreshold)) {
+      continue; // Too light; treat as not touched
+    }
+
+    pointState& st = states [p.id];
+    seen [p.id] = true;
+    st.releaseCount = 0;
+
+    // Smooth the coordinates
+    CSE_UI_TouchPoint out = p;
+
+    if (filterMode == CSEUI_FILTER_MEDIAN) {
+      if (st.historyCount < 3) {
+        st.historyCount++;
+      }
+      st.historyX [2] = st.historyX [1];
+      st.historyX [1] = st.historyX [0];
+      st.historyX [0] = p.x;
+      st.historyY [2] = st.historyY [1];
+      st.historyY [1] = st.historyY [0];
+      st.historyY [0] = p.y;
+
+      if (st.historyCount == 3) {
+        out.x = median3 (st.historyX [0], st.historyX [1], st.historyX [2]);
+        out.y = median3 (st.historyY [0], st.historyY [1], st.historyY [2]);
+      }
+    }
+    else if (filterMode == CSEUI_FILTER_EMA) {
+      if (st.historyCount == 0) { // Start from the first sample
+        st.emaX = (int32_t) p.x << 4;
+        st.emaY = (int32_t) p.y << 4;
+        st.historyCount = 1;
+      }
+      else {
+        st.emaX += ((((int32_t) p.x << 4) - st.emaX) * emaWeight) / 256;
+        st.emaY += ((((int32_t) p.y << 4) - st.emaY) * emaWeight) / 256;
+      }
+      out.x = (st.emaX + 8) >> 4;
+      out.y = (st.emaY + 8) >> 4;
+    }
+
+    st.last = out;
+
+    if ((!st.active) && (++st.pressCount >= pressFrames)) {
+      st.active = true;
+    }
+  }
+
+  // Rebuild the frame from the debounced states
+  frame.count = 0;
+
+  for (int id = 0; id < CSEUI_TOUCH_MAX_POINTS; id++) {
+    pointState& st = states [id];
+
+    if (!seen [id]) {
+      st.pressCount = 0;
+
+      if (st.active && (++st.releaseCount < releaseFrames)) {
+        frame.points [frame.count++] = st.last; // Hold the last position through short dropouts
+        continue;
+      }
+      st.active = false;
+      st.historyCount = 0;
+      continue;
+    }
+
+    if (st.active) {
+      frame.points [frame.count++] = st.last;
+    }
+  }
+}
+
+//============================================================================================//
@@ -0,0 +1,170 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Gesture.cpp
+  Description: Gesture recogniser source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 11:02:18 AM 19-10-2026, Monday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+// Internal states of the recogniser
+
+#define   GESTURE_STATE_IDLE      0   // Not touched
+#define   GESTURE_STATE_DOWN      1   // Touched, not moved beyond the slop
+#define   GESTURE_STATE_DRAG      2   // Touched and moving
+#define   GESTURE_STATE_LONG      3   // Long press reported, waiting for release
+
+//============================================================================================//
+
+gestureClass:: gestureClass() {
+  tapSlop = CSEUI_GESTURE_TAP_SLOP;
+  longPressTime = CSEUI_GESTURE_LONG_PRESS_MS;
+  flickVelocity = CSEUI_GESTURE_FLICK_VELOCITY;
+  reset();
+}
+
+//============================================================================================//
+/**
+ * @brief Resets the recogniser to the idle state. Any gesture in progress is dropped.
+ * 
+ */
+void gestureClass:: reset() {
+  state = GESTURE_STATE_IDLE;
+  startX = 0;
+  startY = 0;
+  lastX = 0;
+  lastY = 0;
+  downTime = 0;
+  lastTime = 0;
+  lastMoveTime = 0;
+  velocityX = 0;
+  velocityY = 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Feeds a touch frame to the recogniser. Call this for every frame, including
+ * the ones without any touch, so that releases and long presses are detected.
+ * 
+ * @param frame The touch frame.
+ * @param gesture The recognised gesture, if any.
+ * @return true A gesture was recognised and written to gesture.
+ * @return false No gesture in this frame.
+ */
+bool gestureClass:: update (const CSE_UI_TouchFrame& frame, CSE_UI_Gesture& gesture) {
+  uint32_t now = frame.timestamp;
+
+  gesture.type = CSEUI_GESTURE_NONE;
+  gesture.startX = startX;
+  gesture.startY = startY;
+  gesture.dx = 0;
+  gesture.dy = 0;
+  gesture.velocityX = 0;
+  gesture.velocityY = 0;
+  gesture.timestamp = now;
+
+  if (frame.count > 0) {
+    int16_t x = frame.points [0].x;
+    int16_t y = frame.points [0].y;
+    gesture.x = x;
+    gesture.y = y;
+
+    if (state == GESTURE_STATE_IDLE) { // A new touch
+      state = GESTURE_STATE_DOWN;
+      startX = lastX = x;
+      startY = lastY = y;
+      downTime = lastTime = lastMoveTime = now;
+      velocityX = 0;
+      velocityY = 0;
+      return false;
+    }
+
+    if (state == GESTURE_STATE_DOWN) {
+      if ((abs (x - startX) > tapSlop) || (abs (y - startY) > tapSlop)) {
+        state = GESTURE_STATE_DRAG; // Moved too far for a tap; report the movement below
+      }
+      else if ((now - downTime) >= ((uint32_t) longPressTime * 1000UL)) {
+        state = GESTURE_STATE_LONG;
+        gesture.type = CSEUI_GESTURE_LONG_PRESS;
+        gesture.startX = startX;
+        gesture.startY = startY;
+        return true;
+      }
+      else {
+        lastTime = now;
+        return false;
+      }
+    }
+
+    if (state == GESTURE_STATE_DRAG) {
+      if ((x == lastX) && (y == lastY)) {
+        lastTime = now;
+        return false;
+      }
+
+      uint32_t dt = now - lastTime;
+
+      if (dt > 0) { // Smooth the instantaneous velocity to reject sampling noise
+        float vx = ((float) (x - lastX) * 1000000.0f) / dt;
+        float vy = ((float) (y - lastY) * 1000000.0f) / dt;
+        velocityX = (0.6f * vx) + (0.4f * velocityX);
+        velocityY = (0.6f * vy) + (0.4f * velocityY);
+      }
+
+      gesture.type = CSEUI_GESTURE_DRAG;
+      gesture.startX = startX;
+      gesture.startY = startY;
+      gesture.dx = x - lastX;
+      gesture.dy = y - lastY;
+      gesture.velocityX = velocityX;
+      gesture.velocityY = velocityY;
+
+      lastX = x;
+      lastY = y;
+      lastTime = now;
+      lastMoveTime = now;
+      return true;
+    }
+
+    return false; // GESTURE_STATE_LONG; wait for the release
+  }
+
+  // Not touched
+  gesture.x = lastX;
+  gesture.y = lastY;
+
+  uint8_t prevState = state;
+  state = GESTURE_STATE_IDLE;
+
+  if (prevState == GESTURE_STATE_DOWN) {
+    gesture.type = CSEUI_GESTURE_TAP;
+    return true;
+  }
+
+  if (prevState == GESTURE_STATE_DRAG) {
+    bool resting = (now - lastMoveTime) > (CSEUI_GESTURE_FLICK_TIMEOUT_MS * 1000UL);
+    float speed = (fabs (velocityX) > fabs (velocityY)) ? fabs (velocityX) : fabs (velocityY);
+
+    if ((!resting) && (speed >= flickVelocity)) {
+      gesture.type = CSEUI_GESTURE_FLICK;
+      gesture.velocityX = velocityX;
+      gesture.velocityY = velocityY;
+    }
+    else {
+      gesture.type = CSEUI_GESTURE_RELEASE;
+    }
+    return true;
+  }
+
+  return false;
+}
+
+//============================================================================================//
@@ -9,7 +9,7 @@
   Version: 0.0.8
   License: MIT
   Source: https://github.com/CIRCUITSTATE/CSE_CST328
-  Last Modified: +05:30 01:06:13 AM 02-03-2025, Sunday
+  Last Modified: +05:30 04:08:45 AM 21-10-2026, Wednesday
  */
 //============================================================================================//
 
@@ -19,6 +19,11 @@
 
 iconClass:: iconClass (CSE_UI* ui) {
   uiParent = ui;
+  fontArray = NULL;
+  spanArray = NULL;
+  alphaArray = NULL;
+  blendValid = false;
+  sizeValid = false;
 }
 
 //============================================================================================//
@@ -36,8 +41,10 @@ iconClass:: iconClass (CSE_UI* ui) {
  * 
  * @return iconClass:: 
  */
-void iconClass:: initialize (const char* array, int w, int h, int byteLen, int byteCount, uint32_t unicode, String n) {
+void iconClass:: initialize (const char* array, int w, int h, int byteLen, int byteCount, uint32_t unicode, const String& n) {
   fontArray = array;
+  spanArray = NULL;
+  alphaArray = NULL;
   fontWidth = w;
   fontHeight = h;
   charByteLength = byteLen;
@@ -48,6 +55,81 @@ void iconClass:: initialize (const char* array, int w, int h, int byteLen, int b
   glyphHeight = 0;
   glyphX = 0;
   glyphY = 0;
+  sizeValid = false;
+}
+
+//============================================================================================//
+/**
+ * @brief Initializes the icon with span-encoded data, as created by tools/icon2spans.py.
+ * 
+ * The data starts with a CSEUI_ICON_SPAN_HEADER_SIZE byte header: the marker
+ * CSEUI_ICON_SPAN_MARKER, the cell width and height, the glyph bounds (X, Y, width,
+ * height) and a reserved byte. Then, for each row of the glyph bounds, comes the number of
+ * spans in the row, followed by the start (from the left of the bounds) and length of each
+ * span. Empty rows and columns around the glyph are not stored.
+ * 
+ * @param spans The span-encoded icon data.
+ * @param unicode The Unicode ID of the icon.
+ * @param n Name of the icon.
+ * @return true The data is valid.
+ * @return false The marker was not found.
+ */
+bool iconClass:: initializeSpans (const uint8_t* spans, uint32_t unicode, const String& n) {
+  fontArray = NULL;
+  spanArray = NULL;
+  alphaArray = NULL;
+  unicodeId = unicode;
+  name = n;
+  sizeValid = false;
+
+  if ((spans == NULL) || (spans [0] != CSEUI_ICON_SPAN_MARKER)) {
+    return false;
+  }
+
+  spanArray = spans;
+  fontWidth = spans [1];
+  fontHeight = spans [2];
+  charByteLength = 0;
+  verticalByteCount = 0;
+  getSize();
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Initializes the icon with 4-bit alpha data, as created by tools/icon2spans.py.
+ * 
+ * The data starts with a CSEUI_ICON_ALPHA_HEADER_SIZE byte header with the same layout as
+ * the span header, but with the marker CSEUI_ICON_ALPHA_MARKER. Then comes the coverage
+ * of each pixel of the glyph bounds, two pixels per byte with the left one in the high
+ * nibble. Each row starts on a new byte. 0 is transparent and 15 is fully covered.
+ * 
+ * @param alpha The alpha icon data.
+ * @param unicode The Unicode ID of the icon.
+ * @param n Name of the icon.
+ * @return true The data is valid.
+ * @return false The marker was not found.
+ */
+bool iconClass:: initializeAlpha (const uint8_t* alpha, uint32_t unicode, const String& n) {
+  fontArray = NULL;
+  spanArray = NULL;
+  alphaArray = NULL;
+  unicodeId = unicode;
+  name = n;
+  sizeValid = false;
+  blendValid = false;
+
+  if ((alpha == NULL) || (alpha [0] != CSEUI_ICON_ALPHA_MARKER)) {
+    return false;
+  }
+
+  alphaArray = alpha;
+  fontWidth = alpha [1];
+  fontHeight = alpha [2];
+  charByteLength = 0;
+  verticalByteCount = 0;
+  getSize();
+  return true;
 }
 
 //============================================================================================//
@@ -60,6 +142,36 @@ void iconClass:: initialize (const char* array, int w, int h, int byteLen, int b
  * @param color 16-bit color value.
  */
 void iconClass:: draw (int16_t x, int16_t y, uint16_t color) {
+  if (spanArray != NULL) {
+    drawSpans (x, y, color);
+    return;
+  }
+
+  if (alphaArray != NULL) { // Without a background, pixels of at least half coverage are drawn
+    getSize();
+
+    const uint8_t* p = alphaArray + CSEUI_ICON_ALPHA_HEADER_SIZE;
+    int rowBytes = (glyphWidth + 1) / 2;
+
+    for (int row = 0; row < glyphHeight; row++) {
+      int start = -1;
+
+      for (int i = 0; i <= glyphWidth; i++) {
+        bool covered = (i < glyphWidth) && (((i & 1) ? (p [i / 2] & 0x0F) : (p [i / 2] >> 4)) >= 8);
+
+        if (covered && (start < 0)) {
+          start = i;
+        }
+        else if ((!covered) && (start >= 0)) {
+          uiParent->lcdParent->drawFastHLine (x + glyphX + start, y + glyphY + row, i - start, color);
+          CSEUI_PROFILE_CALL (i - start);
+          start = -1;
+        }
+      }
+      p += rowBytes;
+    }
+    return;
+  }
 
   char verticalByte = 0; //for vertical bytes
 
@@ -72,6 +184,7 @@ void iconClass:: draw (int16_t x, int16_t y, uint16_t color) {
         for (int m = 0; m < 8; m++) { //iterates through each pixel of a byte
           if ((unsigned (verticalByte >> m)) & 0x1) { //check if a bit is 1
             uiParent->lcdParent->drawPixel ((x + i), y + m + (8 * j), color); //if a bit is 1, then draw pixel with color
+            CSEUI_PROFILE_CALL (1);
           }
         }
       }
@@ -79,15 +192,204 @@ void iconClass:: draw (int16_t x, int16_t y, uint16_t color) {
   }
 }
 
+//============================================================================================//
+/**
+ * @brief Draws the icon over a known background color. Alpha icons are blended with the
+ * background; other icons are drawn as with draw (x, y, color).
+ * 
+ * @param x X coordinate of the icon cell (top-left).
+ * @param y Y coordinate of the icon cell (top-left).
+ * @param color Icon color.
+ * @param bgColor Color behind the icon.
+ */
+void iconClass:: draw (int16_t x, int16_t y, uint16_t color, uint16_t bgColor) {
+  if (alphaArray != NULL) {
+    drawAlpha (x, y, color, bgColor);
+    return;
+  }
+  draw (x, y, color);
+}
+
+//============================================================================================//
+/**
+ * @brief Draws a span-encoded icon with one horizontal line per span. Only the spans are
+ * read, and the empty area around the glyph is skipped.
+ * 
+ * @param x X coordinate of the icon cell (top-left).
+ * @param y Y coordinate of the icon cell (top-left).
+ * @param color 16-bit color value.
+ */
+void iconClass:: drawSpans (int16_t x, int16_t y, uint16_t color) {
+  const uint8_t* p = spanArray + CSEUI_ICON_SPAN_HEADER_SIZE;
+  int16_t left = x + spanArray [3];
+  int16_t top = y + spanArray [4];
+  uint8_t rows = spanArray [6];
+
+  for (uint8_t row = 0; row < rows; row++) {
+    uint8_t count = *p++;
+
+    for (uint8_t s = 0; s < count; s++) {
+      uiParent->lcdParent->drawFastHLine (left + p [0], top + row, p [1], color);
+      CSEUI_PROFILE_CALL (p [1]);
+      p += 2;
+    }
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Computes the colors of the 16 alpha levels for a color pair. The table is kept
+ * until the pair changes, so an icon drawn again in the same colors blends nothing.
+ * 
+ * @param color Icon color.
+ * @param bgColor Background color.
+ */
+void iconClass:: setBlendColors (uint16_t color, uint16_t bgColor) {
+  if (blendValid && (blendFg == color) && (blendBg == bgColor)) return;
+
+  uint8_t fr = color >> 11, fg = (color >> 5) & 0x3F, fb = color & 0x1F;
+  uint8_t br = bgColor >> 11, bg = (bgColor >> 5) & 0x3F, bb = bgColor & 0x1F;
+
+  for (uint8_t a = 0; a < 16; a++) {
+    uint8_t r = ((fr * a) + (br * (15 - a)) + 7) / 15;
+    uint8_t g = ((fg * a) + (bg * (15 - a)) + 7) / 15;
+    uint8_t b = ((fb * a) + (bb * (15 - a)) + 7) / 15;
+
+    blendColors [a] = (r << 11) | (g << 5) | b;
+  }
+
+  blendFg = color;
+  blendBg = bgColor;
+  blendValid = true;
+}
+
+//============================================================================================//
+/**
+ * @brief Draws an alpha icon blended with the background. Each row of the glyph bounds is
+ * looked up in the blend table into a row buffer on the stack, and pushed with one
+ * pushImage(). Nothing is allocated.
+ * 
+ * @param x X coordinate of the icon cell (top-left).
+ * @param y Y coordinate of the icon cell (top-left).
+ * @param color Icon color.
+ * @param bgColor Color behind the icon.
+ */
+void iconClass:: drawAlpha (int16_t x, int16_t y, uint16_t color, uint16_t bgColor) {
+  getSize();
+
+  if ((alphaArray == NULL) || (glyphWidth <= 0) || (glyphWidth > CSEUI_ICON_MAX_WIDTH)) return;
+
+  uint16_t line [CSEUI_ICON_MAX_WIDTH];
+
+  setBlendColors (color, bgColor);
+
+  TFT_eSPI* lcd = uiParent->lcdParent;
+  bool swap = lcd->getSwapBytes();
+  const uint8_t* p = alphaArray + CSEUI_ICON_ALPHA_HEADER_SIZE;
+  int rowBytes = (glyphWidth + 1) / 2;
+
+  lcd->setSwapBytes (true); // The blend table holds native RGB565 values
+
+  for (int row = 0; row < glyphHeight; row++) {
+    for (int i = 0; i < glyphWidth; i++) {
+      line [i] = blendColors [(i & 1) ? (p [i / 2] & 0x0F) : (p [i / 2] >> 4)];
+    }
+
+    lcd->pushImage (x + glyphX, y + glyphY + row, glyphWidth, 1, line);
+    CSEUI_PROFILE_CALL (glyphWidth);
+    p += rowBytes;
+  }
+
+  lcd->setSwapBytes (swap);
+}
+
+//============================================================================================//
+/**
+ * @brief Renders the glyph bounds of the icon into an RGB565 buffer of glyphWidth x
+ * glyphHeight pixels.
+ * 
+ * @param buffer The buffer, row by row.
+ * @param color Icon color.
+ * @param bgColor Background color.
+ */
+void iconClass:: rasterize (uint16_t* buffer, uint16_t color, uint16_t bgColor) {
+  getSize();
+
+  if (alphaArray != NULL) {
+    const uint8_t* p = alphaArray + CSEUI_ICON_ALPHA_HEADER_SIZE;
+
+    setBlendColors (color, bgColor);
+
+    for (int row = 0; row < glyphHeight; row++) {
+      for (int i = 0; i < glyphWidth; i++) {
+        buffer [(row * glyphWidth) + i] = blendColors [(i & 1) ? (p [i / 2] & 0x0F) : (p [i / 2] >> 4)];
+      }
+      p += (glyphWidth + 1) / 2;
+    }
+    return;
+  }
+
+  uint32_t count = (uint32_t) glyphWidth * glyphHeight;
+
+  for (uint32_t i = 0; i < count; i++) {
+    buffer [i] = bgColor;
+  }
+
+  if (spanArray != NULL) {
+    const uint8_t* p = spanArray + CSEUI_ICON_SPAN_HEADER_SIZE;
+
+    for (int row = 0; row < glyphHeight; row++) {
+      uint8_t spans = *p++;
+
+      for (uint8_t s = 0; s < spans; s++) {
+        uint16_t* out = buffer + (row * glyphWidth) + p [0];
+
+        for (uint8_t k = 0; k < p [1]; k++) {
+          out [k] = color;
+        }
+        p += 2;
+      }
+    }
+    return;
+  }
+
+  for (int i = 0; i < glyphWidth; i++) { // Columns of the glyph bounds
+    int column = glyphX + i;
+
+    for (int row = 0; row < glyphHeight; row++) {
+      int y = glyphY + row;
+      char verticalByte = fontArray [((y / 8) + 1) + (column * verticalByteCount)];
+
+      if ((unsigned (verticalByte >> (y % 8))) & 0x1) {
+        buffer [(row * glyphWidth) + i] = color;
+      }
+    }
+  }
+}
+
 //============================================================================================//
 /**
  * @brief Gets the width, height and offsets of a icon, char or string in pixels.
  * An offset is simply how many lines of empty pixels are before a valid black pixel.
  * The calculated values are stored in the global variables glyphWidth, glyphHeight,
- * glyphX and glyphY.
+ * glyphX and glyphY. The values are computed once and then reused. Span-encoded icons
+ * already have them in the header.
  * 
  */
 void iconClass:: getSize() {
+  if (sizeValid) return;
+
+  const uint8_t* header = (spanArray != NULL) ? spanArray : alphaArray;
+
+  if (header != NULL) { // Span and alpha icons store the glyph bounds
+    glyphX = header [3];
+    glyphY = header [4];
+    glyphWidth = header [5];
+    glyphHeight = header [6];
+    sizeValid = true;
+    return;
+  }
+
   char verticalByte = 0; //for vertical bytes
 
   bool areAllBytesZero = true; //whether all bytes in a verticl set are zero
@@ -133,6 +435,7 @@ void iconClass:: getSize() {
 
   glyphWidth = fontWidth - (glyphOffsetLeft + (fontWidth - (glyphOffsetRight + 1)));
   glyphHeight = fontHeight - (glyphOffsetTop + (fontHeight - (glyphOffsetBottom + 1)));
+  sizeValid = true;
 
   // Serial.print("getSize(icon) - ");
   // Serial.println(name);
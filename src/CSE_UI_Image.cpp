@@ -0,0 +1,331 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Image.cpp
+  Description: Streaming image source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 03:52:07 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+
+imageClass:: imageClass (CSE_UI* ui) {
+  uiParent = ui;
+  widgetType = CSEUI_WIDGET_IMAGE;
+  opaque = true;
+  source = NULL;
+  dataOffset = 0;
+  imageX = 0;
+  imageY = 0;
+  imageWidth = 0;
+  imageHeight = 0;
+  imageFormat = CSEUI_IMAGE_RGB565;
+  stripHeight = CSEUI_IMAGE_DEF_STRIP_HEIGHT;
+  imageVisible = true;
+  stateChanged = true;
+  decodeTime = 0;
+  pushTime = 0;
+  stripBuffer = NULL;
+  stripBufferSize = 0;
+  stripBufferOwned = false;
+}
+
+//============================================================================================//
+
+imageClass:: ~imageClass() {
+  freeStripBuffer();
+}
+
+//============================================================================================//
+/**
+ * @brief Frees the strip buffer if the image allocated it, and forgets it either way.
+ * 
+ */
+void imageClass:: freeStripBuffer() {
+  if (stripBufferOwned) {
+    free (stripBuffer);
+  }
+  stripBuffer = NULL;
+  stripBufferSize = 0;
+  stripBufferOwned = false;
+}
+
+//============================================================================================//
+/**
+ * @brief Sets a buffer to decode the strips into, instead of allocating one. A buffer can
+ * be shared by images that are not drawn at the same time. If it holds fewer rows than
+ * the strip height, fewer rows are decoded at once.
+ * 
+ * @param buffer The buffer, or NULL to let the image allocate its own on the next draw.
+ * @param pixels Size of the buffer in pixels. It must hold at least one row of the image.
+ */
+void imageClass:: setStripBuffer (uint16_t* buffer, uint32_t pixels) {
+  freeStripBuffer();
+
+  if (buffer != NULL) {
+    stripBuffer = buffer;
+    stripBufferSize = pixels;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Initializes the image by reading its header, and the palette if it has one.
+ * 
+ * @param x X-coordinate of the top-left of the image.
+ * @param y Y-coordinate of the top-left of the image.
+ * @param src Byte source holding the image. It must stay valid while the image is used.
+ * @param strip Rows decoded and pushed at once. Taller strips need more RAM but make fewer
+ * LCD transfers.
+ * @return true The header is valid.
+ * @return false The source is not a supported image.
+ */
+bool imageClass:: initialize (int x, int y, byteSourceClass* src, uint16_t strip) {
+  imageX = x;
+  imageY = y;
+  source = src;
+  stripHeight = (strip > 0) ? strip : 1;
+  imageVisible = true;
+  stateChanged = true;
+  imageWidth = 0;
+  imageHeight = 0;
+  palette.clear();
+
+  uint8_t header [CSEUI_IMAGE_HEADER_SIZE];
+
+  if ((source == NULL) || (source->read (0, header, CSEUI_IMAGE_HEADER_SIZE) != CSEUI_IMAGE_HEADER_SIZE)) {
+    return false;
+  }
+
+  if ((header [0] != 'C') || (header [1] != 'S') || (header [2] != 'I') || (header [3] > CSEUI_IMAGE_PALETTE)) {
+    return false;
+  }
+
+  imageFormat = header [3];
+  uint16_t paletteCount = header [8] | (header [9] << 8);
+  dataOffset = CSEUI_IMAGE_HEADER_SIZE;
+
+  if (imageFormat == CSEUI_IMAGE_PALETTE) {
+    if ((paletteCount == 0) || (paletteCount > 256)) return false;
+
+    palette.resize (paletteCount);
+
+    for (uint16_t i = 0; i < paletteCount; i++) {
+      uint8_t entry [2];
+      if (source->read (dataOffset, entry, 2) != 2) return false;
+      palette [i] = entry [0] | (entry [1] << 8);
+      dataOffset += 2;
+    }
+  }
+
+  imageWidth = header [4] | (header [5] << 8);
+  imageHeight = header [6] | (header [7] << 8);
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the next byte of the pixel data, reading a new chunk when needed.
+ * 
+ * @return int The byte, or -1 at the end of the source.
+ */
+int imageClass:: readByte() {
+  if (chunkPos >= chunkLength) {
+    chunkLength = source->read (chunkOffset, chunk, sizeof (chunk));
+    chunkOffset += chunkLength;
+    chunkPos = 0;
+
+    if (chunkLength == 0) return -1;
+  }
+  return chunk [chunkPos++];
+}
+
+//============================================================================================//
+/**
+ * @brief Decodes the next pixel. Missing data decodes as black.
+ * 
+ * @return uint16_t RGB565 color.
+ */
+uint16_t imageClass:: readPixel() {
+  int lo, hi;
+
+  switch (imageFormat) {
+    case CSEUI_IMAGE_PALETTE:
+      lo = readByte();
+      return ((lo >= 0) && (lo < (int) palette.size())) ? palette [lo] : 0;
+
+    case CSEUI_IMAGE_RLE:
+      if (runLength == 0) { // Start a new run
+        int c = readByte();
+        if (c < 0) return 0;
+
+        runRepeat = (c & 0x80) != 0;
+        runLength = (c & 0x7F) + 1;
+
+        if (runRepeat) {
+          lo = readByte();
+          hi = readByte();
+          runColor = (hi < 0) ? 0 : (lo | (hi << 8));
+        }
+      }
+
+      runLength--;
+
+      if (runRepeat) return runColor;
+
+      // Literal pixel
+      lo = readByte();
+      hi = readByte();
+      return (hi < 0) ? 0 : (lo | (hi << 8));
+
+    default:
+      lo = readByte();
+      hi = readByte();
+      return (hi < 0) ? 0 : (lo | (hi << 8));
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Decodes the given number of pixels into the buffer.
+ * 
+ */
+void imageClass:: decodeStrip (uint16_t* buffer, uint32_t count) {
+  if (imageFormat == CSEUI_IMAGE_RGB565) { // Copy whole chunks when possible
+    uint32_t i = 0;
+
+    while (i < count) {
+      if ((chunkLength - chunkPos) >= 2) {
+        buffer [i++] = chunk [chunkPos] | (chunk [chunkPos + 1] << 8);
+        chunkPos += 2;
+      }
+      else {
+        buffer [i++] = readPixel();
+      }
+    }
+    return;
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    buffer [i] = readPixel();
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Draws the image strip by strip. Nothing is drawn unless the state changed. The
+ * strip buffer is allocated on the first draw, unless one was set with setStripBuffer().
+ * The time spent decoding and pushing is saved in decodeTime and pushTime.
+ * 
+ */
+void imageClass:: draw() {
+  CSEUI_PROFILE_SCOPE ("image");
+
+  if ((!imageVisible) || (!stateChanged) || (source == NULL) || (imageWidth == 0)) return;
+
+  uint16_t rows = (stripHeight < imageHeight) ? stripHeight : imageHeight;
+
+  if (stripBufferOwned && (stripBufferSize < ((uint32_t) imageWidth * rows))) {
+    freeStripBuffer();  // The image changed to a wider one
+  }
+
+  if (stripBuffer == NULL) {
+    stripBuffer = (uint16_t*) malloc ((uint32_t) imageWidth * rows * 2);
+
+    if (stripBuffer == NULL) return; // Try again with a smaller strip height
+
+    stripBufferSize = (uint32_t) imageWidth * rows;
+    stripBufferOwned = true;
+  }
+
+  if ((stripBufferSize / imageWidth) < rows) { // A caller buffer that is shorter
+    rows = stripBufferSize / imageWidth;
+    if (rows == 0) return;
+  }
+
+  uint16_t* buffer = stripBuffer;
+
+  chunkOffset = dataOffset;
+  chunkPos = 0;
+  chunkLength = 0;
+  runLength = 0;
+  runRepeat = false;
+  runColor = 0;
+  decodeTime = 0;
+  pushTime = 0;
+
+  TFT_eSPI* lcd = uiParent->lcdParent;
+  bool swap = lcd->getSwapBytes();
+  lcd->setSwapBytes (true); // The buffer holds native RGB565 values
+
+  for (uint16_t y = 0; y < imageHeight; y += rows) {
+    uint16_t stripRows = ((imageHeight - y) < rows) ? (imageHeight - y) : rows;
+    uint32_t start = micros();
+
+    decodeStrip (buffer, (uint32_t) imageWidth * stripRows);
+    uint32_t decoded = micros();
+    decodeTime += decoded - start;
+
+    lcd->pushImage (imageX, imageY + y, imageWidth, stripRows, buffer);
+    pushTime += micros() - decoded;
+    CSEUI_PROFILE_CALL ((uint32_t) imageWidth * stripRows);
+  }
+
+  lcd->setSwapBytes (swap);
+  stateChanged = false;
+}
+
+//============================================================================================//
+/**
+ * @brief Triggers a redraw.
+ * 
+ */
+void imageClass:: reset() {
+  stateChanged = true;
+}
+
+//============================================================================================//
+
+void imageClass:: invalidate() {
+  stateChanged = true;
+}
+
+//============================================================================================//
+
+bool imageClass:: getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  if (!imageVisible) return false;
+
+  x = imageX;
+  y = imageY;
+  w = imageWidth;
+  h = imageHeight;
+  return true;
+}
+
+//============================================================================================//
+
+bool imageClass:: isDirty() {
+  return imageVisible && stateChanged;
+}
+
+//============================================================================================//
+
+void imageClass:: show() {
+  imageVisible = true;
+  stateChanged = true;
+}
+
+//============================================================================================//
+
+void imageClass:: hide() {
+  imageVisible = false;
+}
+
+//============================================================================================//
@@ -0,0 +1,246 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Latency.cpp
+  Description: Touch-to-photon latency statistics source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 07:52:36 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+
+latencyStatsClass:: latencyStatsClass() {
+  reset();
+}
+
+//============================================================================================//
+/**
+ * @brief Clears all samples.
+ * 
+ */
+void latencyStatsClass:: reset() {
+  for (int i = 0; i < CSEUI_LATENCY_BUCKETS; i++) {
+    histogram [i] = 0;
+  }
+  count = 0;
+  minValue = 0;
+  maxValue = 0;
+  sum = 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Adds a latency sample.
+ * 
+ * @param us Latency in microseconds.
+ */
+void latencyStatsClass:: record (uint32_t us) {
+  uint32_t bucket = us / 1000;
+
+  if (bucket >= CSEUI_LATENCY_BUCKETS) {
+    bucket = CSEUI_LATENCY_BUCKETS - 1;
+  }
+  histogram [bucket]++;
+
+  if ((count == 0) || (us < minValue)) minValue = us;
+  if (us > maxValue) maxValue = us;
+
+  sum += us;
+  count++;
+}
+
+//============================================================================================//
+
+uint32_t latencyStatsClass:: getCount() {
+  return count;
+}
+
+//============================================================================================//
+
+uint32_t latencyStatsClass:: getMin() {
+  return minValue;
+}
+
+//============================================================================================//
+
+uint32_t latencyStatsClass:: getMax() {
+  return maxValue;
+}
+
+//============================================================================================//
+
+uint32_t latencyStatsClass:: getAverage() {
+  if (count == 0) return 0;
+  return (uint32_t) (sum / count);
+}
+
+//============================================================================================//
+/**
+ * @brief Returns a percentile of the samples, rounded up to the end of its 1 ms bucket
+ * and limited to the largest sample.
+ * 
+ * @param pct Percentile, 1-100.
+ * @return uint32_t Latency in microseconds.
+ */
+uint32_t latencyStatsClass:: getPercentile (uint8_t pct) {
+  if (count == 0) return 0;
+  if (pct > 100) pct = 100;
+
+  uint32_t target = (uint32_t) (((uint64_t) count * pct + 99) / 100); // Rank of the sample
+  uint32_t seen = 0;
+
+  for (int i = 0; i < CSEUI_LATENCY_BUCKETS; i++) {
+    seen += histogram [i];
+
+    if (seen >= target) {
+      uint32_t value = (i + 1) * 1000UL;
+      return (value < maxValue) ? value : maxValue;
+    }
+  }
+  return maxValue;
+}
+
+//============================================================================================//
+/**
+ * @brief Prints the statistics in a line-based format that is easy to parse.
+ * 
+ *   CSEUI_LATENCY count=<n> min=<us> avg=<us> p99=<us> max=<us>
+ *   CSEUI_LATENCY_HIST <ms>:<count> <ms>:<count> ...
+ * 
+ * Only the non-empty buckets are printed. The last bucket holds everything above it.
+ * 
+ * @param out The output, such as Serial.
+ */
+void latencyStatsClass:: print (Print& out) {
+  out.print (F("CSEUI_LATENCY count="));
+  out.print (count);
+  out.print (F(" min="));
+  out.print (getMin());
+  out.print (F(" avg="));
+  out.print (getAverage());
+  out.print (F(" p99="));
+  out.print (getPercentile (99));
+  out.print (F(" max="));
+  out.println (getMax());
+
+  out.print (F("CSEUI_LATENCY_HIST"));
+  for (int i = 0; i < CSEUI_LATENCY_BUCKETS; i++) {
+    if (histogram [i] > 0) {
+      out.print (' ');
+      out.print (i);
+      out.print (':');
+      out.print (histogram [i]);
+    }
+  }
+  out.println();
+}
+
+//============================================================================================//
+/**
+ * @brief Records the latency of a redraw that has just finished.
+ * 
+ * @param inputTime Acquisition time of the touch frame that caused the redraw.
+ */
+void CSE_UI:: recordLatency (uint32_t inputTime) {
+  latency.record (micros() - inputTime);
+}
+
+//============================================================================================//
+
+static bool touchInRect (const CSE_UI_TouchFrame& frame, int16_t x, int16_t y, int16_t w, int16_t h) {
+  for (int i = 0; i < frame.count; i++) {
+    const CSE_UI_TouchPoint& p = frame.points [i];
+
+    if ((p.x >= x) && (p.x < (x + w)) && (p.y >= y) && (p.y < (y + h))) return true;
+  }
+  return false;
+}
+
+//============================================================================================//
+/**
+ * @brief Starts timing the redraw of a dirty widget, if the touch snapshot changed in this
+ * frame and a point of it, or of the snapshot before it, is on the widget. The start is
+ * the acquisition time of the snapshot. Widgets that are dirty for other reasons, such as
+ * a clock, are not timed, nor are widgets that do not report their bounds.
+ * 
+ * Called by tick() and pageClass:: drawWidget() for every dirty widget they see. A widget
+ * that is already being timed keeps its start, so a redraw left for a later tick is timed
+ * from the touch that caused it.
+ * 
+ * @param widget A dirty widget.
+ */
+void CSE_UI:: startLatency (widgetClass* widget) {
+  if (widget->latencyPending || (!touchChanged)) return;
+
+  int16_t x, y, w, h;
+
+  if (!widget->getBounds (x, y, w, h)) return;
+
+  if (touchInRect (touchFrame, x, y, w, h) || touchInRect (prevTouchFrame, x, y, w, h)) {
+    widget->latencyPending = true;
+    widget->latencyStart = touchFrame.timestamp;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Records the latency of a widget being timed. Called by pageClass:: drawWidget()
+ * after the last drawing call of the widget returns.
+ * 
+ * @param widget The widget that was drawn.
+ */
+void CSE_UI:: finishLatency (widgetClass* widget) {
+  if (widget->latencyPending) {
+    recordLatency (widget->latencyStart);
+    widget->latencyPending = false;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the lowest touch-to-photon latency in microseconds.
+ * 
+ * @return uint32_t 
+ */
+uint32_t CSE_UI:: getLatencyMin() {
+  return latency.getMin();
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the average touch-to-photon latency in microseconds.
+ * 
+ * @return uint32_t 
+ */
+uint32_t CSE_UI:: getLatencyAverage() {
+  return latency.getAverage();
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the 99th percentile touch-to-photon latency in microseconds.
+ * 
+ * @return uint32_t 
+ */
+uint32_t CSE_UI:: getLatencyP99() {
+  return latency.getPercentile (99);
+}
+
+//============================================================================================//
+/**
+ * @brief Prints the latency statistics. See latencyStatsClass:: print() for the format.
+ * 
+ * @param out The output, such as Serial.
+ */
+void CSE_UI:: printLatency (Print& out) {
+  latency.print (out);
+}
+
+//============================================================================================//
@@ -0,0 +1,342 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Layers.cpp
+  Description: Widget stacking and occlusion source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 08:31:57 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+
+struct clipRect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+//============================================================================================//
+
+static bool rectsOverlap (const clipRect& a, const clipRect& b) {
+  return (a.x < (b.x + b.w)) && ((a.x + a.w) > b.x) && (a.y < (b.y + b.h)) && ((a.y + a.h) > b.y);
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the overlap of two rectangles. The width or height is 0 if they do not
+ * overlap.
+ * 
+ */
+static clipRect intersectRect (const clipRect& a, const clipRect& b) {
+  int16_t left = (a.x > b.x) ? a.x : b.x;
+  int16_t top = (a.y > b.y) ? a.y : b.y;
+  int16_t right = ((a.x + a.w) < (b.x + b.w)) ? (a.x + a.w) : (b.x + b.w);
+  int16_t bottom = ((a.y + a.h) < (b.y + b.h)) ? (a.y + a.h) : (b.y + b.h);
+
+  if (right < left) right = left;
+  if (bottom < top) bottom = top;
+
+  clipRect r = { left, top, (int16_t) (right - left), (int16_t) (bottom - top) };
+  return r;
+}
+
+//============================================================================================//
+/**
+ * @brief Removes a rectangle from a set of rectangles. Each rectangle that overlaps the
+ * cut is replaced by up to four pieces around it: above, below, left and right.
+ * 
+ * @param rects The rectangles; updated in place.
+ * @param count Number of rectangles.
+ * @param cut The rectangle to remove.
+ * @return int The new number of rectangles, or -1 if they do not fit in CSEUI_CLIP_MAX_RECTS.
+ */
+static int subtractRect (clipRect* rects, int count, const clipRect& cut) {
+  clipRect pieces [CSEUI_CLIP_MAX_RECTS];
+  int n = 0;
+
+  for (int i = 0; i < count; i++) {
+    const clipRect& r = rects [i];
+
+    if (!rectsOverlap (r, cut)) {
+      if (n >= CSEUI_CLIP_MAX_RECTS) return -1;
+      pieces [n++] = r;
+      continue;
+    }
+
+    int16_t top = (cut.y > r.y) ? cut.y : r.y;
+    int16_t bottom = ((cut.y + cut.h) < (r.y + r.h)) ? (cut.y + cut.h) : (r.y + r.h);
+    clipRect parts [4];
+    int partCount = 0;
+
+    if (cut.y > r.y) {
+      parts [partCount++] = { r.x, r.y, r.w, (int16_t) (cut.y - r.y) };
+    }
+    if ((cut.y + cut.h) < (r.y + r.h)) {
+      parts [partCount++] = { r.x, (int16_t) (cut.y + cut.h), r.w, (int16_t) ((r.y + r.h) - (cut.y + cut.h)) };
+    }
+    if (cut.x > r.x) {
+      parts [partCount++] = { r.x, top, (int16_t) (cut.x - r.x), (int16_t) (bottom - top) };
+    }
+    if ((cut.x + cut.w) < (r.x + r.w)) {
+      parts [partCount++] = { (int16_t) (cut.x + cut.w), top, (int16_t) ((r.x + r.w) - (cut.x + cut.w)), (int16_t) (bottom - top) };
+    }
+
+    if ((n + partCount) > CSEUI_CLIP_MAX_RECTS) return -1;
+
+    for (int j = 0; j < partCount; j++) {
+      pieces [n++] = parts [j];
+    }
+  }
+
+  for (int i = 0; i < n; i++) {
+    rects [i] = pieces [i];
+  }
+  return n;
+}
+
+//============================================================================================//
+/**
+ * @brief Draws one widget of the page, taking the widgets above it into account.
+ * 
+ *  - A widget that is completely covered by opaque widgets above it is not drawn. It keeps
+ *    its changes until it is uncovered and invalidated. The open dialog, if this is the
+ *    shown page, is the top layer and covers the widgets like an opaque widget.
+ *  - A widget that is partly covered is drawn once for each uncovered rectangle, clipped
+ *    to it. The widget is invalidated between the draws, since the first draw clears its
+ *    changes. If a viewport of the widget could not be clipped, it is drawn once more,
+ *    clipped to the bounding box of the uncovered part.
+ *  - If the widget changed any pixels under a widget above it, those widgets are
+ *    invalidated, so they are drawn again after it. Only the area the widget reports
+ *    through getChangedBounds() is used.
+ * 
+ * Widgets that are not dirty are skipped. Widgets that do not report their bounds are
+ * drawn as they are, or skipped while a dialog is open, since they could draw over it. If the widget became dirty in a frame with new touch input, the
+ * time from that touch frame to the end of the last draw is recorded as its latency,
+ * unless the draw changed nothing.
+ * 
+ * @param widget A widget of this page.
+ * @return true The widget was drawn.
+ * @return false The widget was not dirty, or is covered.
+ */
+bool pageClass:: drawWidget (widgetClass* widget) {
+  if (!widget->isDirty()) return false;
+
+  uiParent->startLatency (widget);
+
+  dialogClass* dialog = (uiParent->activePage == this) ? uiParent->modalDialog : NULL;
+  clipRect bounds;
+
+  if (dialog == widget) dialog = NULL;
+
+  if (!widget->getBounds (bounds.x, bounds.y, bounds.w, bounds.h)) {
+    if (dialog != NULL) return false; // Keeps its changes until the dialog is closed
+
+    widget->draw();
+    uiParent->finishLatency (widget);
+    return true;
+  }
+
+  clipRect exposed [CSEUI_CLIP_MAX_RECTS];
+  int count = 1;
+
+  exposed [0] = bounds;
+
+  for (widgetClass* w = widget->nextWidget; (w != NULL) && (count > 0); w = w->nextWidget) {
+    clipRect cover;
+
+    if (!w->getOpaqueBounds (cover.x, cover.y, cover.w, cover.h)) continue;
+
+    count = subtractRect (exposed, count, cover);
+
+    if (count < 0) { // Too many pieces; draw the whole widget
+      exposed [0] = bounds;
+      count = 1;
+      break;
+    }
+  }
+
+  clipRect dialogBounds;
+
+  if ((dialog != NULL) && (count > 0) && dialog->getBounds (dialogBounds.x, dialogBounds.y, dialogBounds.w, dialogBounds.h)) {
+    if (rectsOverlap (bounds, dialogBounds)) {
+      int pieces = subtractRect (exposed, count, dialogBounds);
+
+      if (pieces < 0) { // Too many pieces; draw the whole widget around the dialog
+        exposed [0] = bounds;
+        pieces = subtractRect (exposed, 1, dialogBounds);
+      }
+      count = pieces;
+      dialog->saveStale = dialog->saveStale || (count > 0);
+    }
+    else {
+      dialog = NULL;
+    }
+  }
+
+  if (count == 0) { // Covered by opaque widgets; nothing shows, so nothing to time
+    widget->latencyPending = false;
+    return false;
+  }
+
+  clipRect changed [CSEUI_CLIP_MAX_RECTS]; // Areas the widget changed, one per draw
+  int changedCount = 0;
+
+  if ((count == 1) && (exposed [0].w == bounds.w) && (exposed [0].h == bounds.h)) {
+    widget->draw();
+
+    if (widget->getChangedBounds (changed [0].x, changed [0].y, changed [0].w, changed [0].h)) {
+      changedCount = 1;
+    }
+  }
+  else {
+    bool exact = true;
+
+    for (int i = 0; (i < count) && exact; i++) {
+      if (i > 0) {
+        widget->invalidate(); // The first draw cleared the changes
+      }
+
+      uiParent->setClip (exposed [i].x, exposed [i].y, exposed [i].w, exposed [i].h);
+      widget->draw();
+      exact = uiParent->clipExact;
+      uiParent->clearClip();
+
+      clipRect& piece = changed [changedCount];
+
+      if (widget->getChangedBounds (piece.x, piece.y, piece.w, piece.h)) {
+        piece = intersectRect (piece, exposed [i]);
+
+        if ((piece.w > 0) && (piece.h > 0)) {
+          changedCount++;
+        }
+      }
+    }
+
+    if (!exact) { // Draw what the clipped viewports missed, and assume all of it changed
+      int16_t left = exposed [0].x;
+      int16_t top = exposed [0].y;
+      int16_t right = exposed [0].x + exposed [0].w;
+      int16_t bottom = exposed [0].y + exposed [0].h;
+
+      for (int i = 1; i < count; i++) {
+        if (exposed [i].x < left) left = exposed [i].x;
+        if (exposed [i].y < top) top = exposed [i].y;
+        if ((exposed [i].x + exposed [i].w) > right) right = exposed [i].x + exposed [i].w;
+        if ((exposed [i].y + exposed [i].h) > bottom) bottom = exposed [i].y + exposed [i].h;
+      }
+
+      widget->invalidate();
+      uiParent->setClip (left, top, right - left, bottom - top);
+      widget->draw();
+      uiParent->clearClip();
+      changed [0] = bounds;
+      changedCount = 1;
+    }
+  }
+
+  if (dialog != NULL) { // A draw that could not be clipped may have covered the dialog
+    for (int i = 0; i < changedCount; i++) {
+      if (rectsOverlap (changed [i], dialogBounds)) {
+        dialog->invalidate();
+        break;
+      }
+    }
+  }
+
+  if (changedCount > 0) {
+    uiParent->finishLatency (widget);
+  }
+  else { // The touch did not change what is shown
+    widget->latencyPending = false;
+  }
+
+  for (widgetClass* w = widget->nextWidget; w != NULL; w = w->nextWidget) {
+    clipRect above;
+
+    if (!w->getBounds (above.x, above.y, above.w, above.h)) continue;
+
+    for (int i = 0; i < changedCount; i++) {
+      if (rectsOverlap (above, changed [i])) {
+        w->invalidate();
+        break;
+      }
+    }
+  }
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Moves a widget of the page to another level of the stacking order. The widgets
+ * in its area are invalidated, since what is on top there may have changed.
+ * 
+ * @param widget A widget of this page.
+ * @param z The new zOrder.
+ */
+void pageClass:: setZOrder (widgetClass* widget, uint8_t z) {
+  widgetClass* prev = NULL;
+  widgetClass* w = firstWidget;
+
+  while ((w != NULL) && (w != widget)) {
+    prev = w;
+    w = w->nextWidget;
+  }
+
+  if (w == NULL) return;  // Not on this page
+
+  if (prev == NULL) {
+    firstWidget = widget->nextWidget;
+  }
+  else {
+    prev->nextWidget = widget->nextWidget;
+  }
+
+  if (lastWidget == widget) {
+    lastWidget = prev;
+  }
+
+  widgetCount--;
+  widget->zOrder = z;
+  addWidget (widget);
+
+  int16_t x, y, width, height;
+
+  if (widget->getBounds (x, y, width, height)) {
+    invalidateArea (x, y, width, height);
+  }
+  else {
+    widget->invalidate();
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Invalidates the widgets that overlap an area, such as the area a hidden or moved
+ * widget uncovered. Widgets that do not report their bounds are invalidated too.
+ * 
+ * @param x X-coordinate of the area.
+ * @param y Y-coordinate of the area.
+ * @param w Width of the area.
+ * @param h Height of the area.
+ */
+void pageClass:: invalidateArea (int16_t x, int16_t y, int16_t w, int16_t h) {
+  clipRect area = { x, y, w, h };
+
+  for (widgetClass* widget = firstWidget; widget != NULL; widget = widget->nextWidget) {
+    clipRect bounds;
+
+    if ((!widget->getBounds (bounds.x, bounds.y, bounds.w, bounds.h)) || rectsOverlap (bounds, area)) {
+      widget->invalidate();
+    }
+  }
+}
+
+//============================================================================================//
@@ -9,7 +9,7 @@
   Version: 0.0.8
   License: MIT
   Source: https://github.com/CIRCUITSTATE/CSE_CST328
-  Last Modified: +05:30 01:06:45 AM 02-03-2025, Sunday
+  Last Modified: +05:30 05:24:09 AM 21-10-2026, Wednesday
  */
 //============================================================================================//
 
@@ -25,6 +25,35 @@
 
 listClass:: listClass (CSE_UI* ui) {
   uiParent = ui;
+  widgetType = CSEUI_WIDGET_LIST;
+  itemCount = 0;
+  itemVisibleCount = 0;
+  currentItem = 0;
+  prevItem = -1;
+  currentVisibleItem = 0;
+  scrollPosition = 0;
+  kineticEnabled = false;
+  scrollOffset = 0;
+  drawnOffset = 0;
+  scrollVelocity = 0;
+  scrollRemainder = 0;
+  scrollFriction = CSEUI_LIST_SCROLL_FRICTION;
+  kineticTime = 0;
+  kineticRedraw = true;
+  kineticFocusPrev = -1;
+  scrollSprite = NULL;
+}
+
+//============================================================================================//
+/**
+ * @brief Frees the viewport buffer of the kinetic scroll, if there is one.
+ * 
+ */
+listClass:: ~listClass() {
+  if (scrollSprite != NULL) {
+    scrollSprite->deleteSprite();
+    delete scrollSprite;
+  }
 }
 
 //============================================================================================//
@@ -47,7 +76,7 @@ void listClass:: initialize (int16_t x, int16_t y, int w, int h, uint16_t fgcolo
 
 //============================================================================================//
 
-void listClass:: addItem (buttonClass* item, String label) {
+void listClass:: addItem (buttonClass* item, const String& label) {
   itemList.push_back (item);
 
   itemList [itemCount]->initialize (listX, listY + (itemCount * itemHeight), itemWidth, itemHeight, itemBgColor, itemFgColor, label);
@@ -56,6 +85,37 @@ void listClass:: addItem (buttonClass* item, String label) {
   itemCount++;
 }
 
+//============================================================================================//
+/**
+ * @brief Creates a list item in an arena, such as the arena of the page the list is in,
+ * and adds it to the list. The item is destroyed with the arena.
+ * 
+ * @param label Label of the item.
+ * @param arena The arena.
+ * @return buttonClass* The item, or NULL if the arena is full.
+ */
+buttonClass* listClass:: addItem (const String& label, arenaClass* arena) {
+  buttonClass* item = arena->create <buttonClass> (uiParent);
+
+  if (item != NULL) {
+    addItem (item, label);
+  }
+  return item;
+}
+
+//============================================================================================//
+/**
+ * @brief Reserves space for the given number of items. Call this before adding a large
+ * number of items to avoid repeated reallocations of the item list.
+ * 
+ * @param count Expected number of items.
+ */
+void listClass:: reserveItems (int count) {
+  if (count > 0) {
+    itemList.reserve (count);
+  }
+}
+
 //============================================================================================//
 
 void listClass:: reset() {
@@ -63,12 +123,51 @@ void listClass:: reset() {
   prevItem = -1;
   currentVisibleItem = 0;
   scrollPosition = 0;
+  scrollOffset = 0;
+  scrollVelocity = 0;
+  kineticRedraw = true;
 
   for (int i = 0; i < itemCount; i++) {
     itemList [i]->reset();
   }
 }
 
+//============================================================================================//
+/**
+ * @brief Marks the visible rows of the list for a redraw.
+ * 
+ */
+void listClass:: invalidate() {
+  triggerStateChange();
+}
+
+//============================================================================================//
+
+bool listClass:: isDirty() {
+  if (!visible) return false;
+
+  if (kineticEnabled) {
+    return (scrollVelocity != 0) || (scrollOffset != drawnOffset) || kineticRedraw || (kineticFocusPrev >= 0);
+  }
+
+  for (int i = scrollPosition; (i < scrollPosition + itemVisibleCount) && (i < itemCount); i++) {
+    if (itemList [i]->isDirty()) return true;
+  }
+  return false;
+}
+
+//============================================================================================//
+
+bool listClass:: getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  if (!visible) return false;
+
+  x = listX;
+  y = listY;
+  w = itemWidth;
+  h = getViewHeight();
+  return true;
+}
+
 //============================================================================================//
 
 void listClass:: show() {
@@ -83,8 +182,18 @@ void listClass:: hide() {
 
 //============================================================================================//
 
+/**
+ * @brief Makes the visible items redraw after a focus or scroll change. Only the items
+ * inside the visible window are reset, so the cost does not grow with the length of the
+ * list. Items outside the window are reset when a scroll brings them into view.
+ * 
+ */
 void listClass:: triggerStateChange() {
-  for (int i = 0; i < itemCount; i++) {
+  kineticRedraw = true;
+
+  if (kineticEnabled) return; // Rows are redrawn by drawKinetic()
+
+  for (int i = scrollPosition; (i < scrollPosition + itemVisibleCount) && (i < itemCount); i++) {
     itemList [i]->reset();
   }
 }
@@ -93,6 +202,7 @@ void listClass:: triggerStateChange() {
 
 void listClass:: setCurrentItem (int item) {
   currentItem = item;
+  showCurrentItem();
 }
 
 //============================================================================================//
@@ -103,6 +213,11 @@ int listClass:: getCurrentItem() {
 
 //============================================================================================//
 
+/**
+ * @brief Focuses the next item, wrapping around to the first one after the last. The list
+ * scrolls to keep the focused item visible.
+ * 
+ */
 void listClass:: toNextItem() {
   if (currentItem < (itemCount - 1)) {
     currentItem++;
@@ -110,11 +225,16 @@ void listClass:: toNextItem() {
   else {
     currentItem = 0;
   }
+  showCurrentItem();
   triggerStateChange();
 }
 
 //============================================================================================//
-
+/**
+ * @brief Focuses the previous item, wrapping around to the last one before the first.
+ * The list scrolls to keep the focused item visible.
+ * 
+ */
 void listClass:: toPrevItem() {
   if (currentItem > 0) {
     currentItem--;
@@ -122,9 +242,40 @@ void listClass:: toPrevItem() {
   else {
     currentItem = itemCount - 1;
   }
+  showCurrentItem();
   triggerStateChange();
 }
 
+//============================================================================================//
+/**
+ * @brief Scrolls the list by the least amount that brings the focused item into view,
+ * and updates the local index of the focused item.
+ * 
+ */
+void listClass:: showCurrentItem() {
+  int visibleCount = (itemVisibleCount < 1) ? 1 : itemVisibleCount;
+
+  if (currentItem < scrollPosition) {
+    scrollPosition = currentItem;
+  }
+  else if (currentItem >= (scrollPosition + visibleCount)) {
+    scrollPosition = currentItem - visibleCount + 1;
+  }
+  currentVisibleItem = currentItem - scrollPosition;
+
+  if (kineticEnabled) {
+    int32_t rowTop = (int32_t) currentItem * itemHeight;
+
+    if (rowTop < scrollOffset) {
+      scrollOffset = rowTop;
+    }
+    else if ((rowTop + itemHeight) > (scrollOffset + getViewHeight())) {
+      scrollOffset = rowTop + itemHeight - getViewHeight();
+    }
+    scrollVelocity = 0;
+  }
+}
+
 //============================================================================================//
 /**
  * @brief Sets the alignement of the text (label) with respect to the button (box).
@@ -185,7 +336,14 @@ void listClass:: scrollUp() {
 //============================================================================================//
 
 void listClass:: draw() {
+  CSEUI_PROFILE_SCOPE ("list");
+
   if (!visible) return;
+
+  if (kineticEnabled) {
+    drawKinetic();
+    return;
+  }
   
   for (int i = 0; i < itemVisibleCount; i++) {
     // Compute the real index of the item taking into account the scroll position
@@ -208,5 +366,331 @@ void listClass:: draw() {
   }
 }
 
+//============================================================================================//
+/**
+ * @brief Switches the list to pixel-offset scrolling. The list can then be dragged and
+ * flicked through handleGesture(), and keeps moving with inertia after a flick. The
+ * hover effect of the items is disabled since the items are selected by tapping.
+ * 
+ * If useSprite is true, a sprite the size of the viewport is used as a buffer. The
+ * pixels already on screen are then moved inside the buffer, and only the newly
+ * exposed rows are drawn. If the sprite can not be created, the visible rows are drawn
+ * directly, clipped to the viewport.
+ * 
+ * @param useSprite Use a viewport buffer for incremental drawing.
+ */
+void listClass:: enableKineticScroll (bool useSprite) {
+  kineticEnabled = true;
+  scrollOffset = scrollPosition * itemHeight;
+  drawnOffset = scrollOffset;
+  scrollVelocity = 0;
+  kineticRedraw = true;
+  kineticFocusPrev = -1;
+
+  for (int i = 0; i < itemCount; i++) {
+    itemList [i]->hoverDisable();
+  }
+
+  if (useSprite && (scrollSprite == NULL)) {
+    scrollSprite = new TFT_eSprite (uiParent->lcdParent);
+    if (scrollSprite->createSprite (itemWidth, getViewHeight()) == NULL) {
+      delete scrollSprite; // Not enough memory; draw directly instead
+      scrollSprite = NULL;
+    }
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Switches the list back to item-by-item scrolling and frees the viewport buffer.
+ * 
+ */
+void listClass:: disableKineticScroll() {
+  kineticEnabled = false;
+  scrollVelocity = 0;
+
+  if (scrollSprite != NULL) {
+    scrollSprite->deleteSprite();
+    delete scrollSprite;
+    scrollSprite = NULL;
+  }
+
+  scrollPosition = scrollOffset / itemHeight;
+  currentVisibleItem = currentItem - scrollPosition;
+  triggerStateChange();
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the height of the list viewport in pixels.
+ * 
+ * @return int 
+ */
+int listClass:: getViewHeight() {
+  return itemVisibleCount * itemHeight;
+}
+
+//============================================================================================//
+/**
+ * @brief Moves the list content by the given number of pixels. Positive values scroll
+ * towards the end of the list. The offset is clamped to the list bounds.
+ * 
+ * @param dy Pixels to scroll.
+ */
+void listClass:: scrollBy (int32_t dy) {
+  int32_t maxOffset = (int32_t) itemCount * itemHeight - getViewHeight();
+
+  if (maxOffset < 0) maxOffset = 0;
+
+  scrollOffset += dy;
+
+  if (scrollOffset < 0) {
+    scrollOffset = 0;
+    scrollVelocity = 0;
+    scrollRemainder = 0;
+  }
+  else if (scrollOffset > maxOffset) {
+    scrollOffset = maxOffset;
+    scrollVelocity = 0;
+    scrollRemainder = 0;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Starts a kinetic scroll with the given velocity. The list slows down at the
+ * rate set by scrollFriction.
+ * 
+ * @param velocity Velocity in pixels per second. Positive values scroll towards the end.
+ */
+void listClass:: fling (float velocity) {
+  scrollVelocity = velocity;
+  scrollRemainder = 0;
+  kineticTime = micros();
+}
+
+//============================================================================================//
+/**
+ * @brief Stops any kinetic scroll in progress.
+ * 
+ */
+void listClass:: stopScroll() {
+  scrollVelocity = 0;
+  scrollRemainder = 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Applies a gesture to the list. Drags move the content with the finger, flicks
+ * start a kinetic scroll, and taps focus the tapped item. Gestures that did not start
+ * inside the list are ignored.
+ * 
+ * @param g The gesture.
+ * @return true The gesture was used by the list.
+ * @return false The gesture does not belong to the list.
+ */
+bool listClass:: handleGesture (const CSE_UI_Gesture& g) {
+  if ((!visible) || (!kineticEnabled)) return false;
+
+  if ((g.startX < listX) || (g.startX >= (listX + itemWidth)) || (g.startY < listY) || (g.startY >= (listY + getViewHeight()))) {
+    return false;
+  }
+
+  switch (g.type) {
+    case CSEUI_GESTURE_DRAG:
+      scrollVelocity = 0;
+      scrollBy (-g.dy); // Content follows the finger
+      return true;
+
+    case CSEUI_GESTURE_FLICK:
+      fling (-g.velocityY);
+      return true;
+
+    case CSEUI_GESTURE_TAP: {
+      scrollVelocity = 0;
+      int item = (g.y - listY + scrollOffset) / itemHeight;
+
+      if ((item >= 0) && (item < itemCount) && (item != currentItem)) {
+        kineticFocusPrev = currentItem;
+        currentItem = item;
+      }
+      return true;
+    }
+
+    case CSEUI_GESTURE_RELEASE:
+    case CSEUI_GESTURE_LONG_PRESS:
+      return true;
+  }
+
+  return false;
+}
+
+//============================================================================================//
+/**
+ * @brief Advances the kinetic scroll by the time elapsed since the last update. Only
+ * whole pixels are scrolled; the fraction is carried to the next update, so slow
+ * scrolls at high frame rates still move.
+ * 
+ */
+void listClass:: updateKinetic() {
+  uint32_t now = micros();
+
+  if (scrollVelocity == 0) {
+    kineticTime = now;
+    scrollRemainder = 0;
+    return;
+  }
+
+  float dt = (now - kineticTime) / 1000000.0f;
+  kineticTime = now;
+
+  float move = (scrollVelocity * dt) + scrollRemainder;
+  int32_t pixels = (int32_t) move; // Rounds towards zero in both directions
+
+  scrollRemainder = move - pixels;
+  scrollBy (pixels);
+
+  // Decelerate towards zero without overshooting
+  float dv = scrollFriction * dt;
+
+  if (scrollVelocity > 0) {
+    scrollVelocity = (scrollVelocity > dv) ? (scrollVelocity - dv) : 0;
+  }
+  else {
+    scrollVelocity = (-scrollVelocity > dv) ? (scrollVelocity + dv) : 0;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Draws one item at the given Y-coordinate of the current draw target.
+ * 
+ * @param index Global index of the item.
+ * @param y Y-coordinate of the top of the item.
+ */
+void listClass:: drawRow (int index, int16_t y) {
+  buttonClass* item = itemList [index];
+
+  if (index == currentItem) {
+    item->fillColor = itemFocusBgColor;
+    item->labelColor = itemFocusFgColor;
+  }
+  else {
+    item->fillColor = itemBgColor;
+    item->labelColor = itemFgColor;
+  }
+
+  item->setXY (scrollSprite != NULL ? 0 : listX, y);
+  item->updateState (true);
+  item->draw();
+}
+
+//============================================================================================//
+/**
+ * @brief Draws the list in kinetic mode. Only the rows that are not already on the screen
+ * are drawn. The cost of a frame depends on the scrolled distance, not on the number of
+ * items in the list.
+ * 
+ */
+void listClass:: drawKinetic() {
+  updateKinetic();
+
+  int viewHeight = getViewHeight();
+  int32_t delta = scrollOffset - drawnOffset;
+
+  if ((delta == 0) && (!kineticRedraw) && (kineticFocusPrev < 0)) return; // Nothing changed
+
+  // The band of the viewport (in viewport coordinates) that has to be drawn
+  int32_t bandTop = 0;
+  int32_t bandBottom = viewHeight;
+
+  if ((!kineticRedraw) && (abs (delta) < viewHeight)) {
+    if (delta > 0) { // Content moved up; new rows appear at the bottom
+      bandTop = viewHeight - delta;
+    }
+    else if (delta < 0) { // Content moved down; new rows appear at the top
+      bandBottom = -delta;
+    }
+    else {
+      bandBottom = 0; // Only the focus changed
+    }
+  }
+
+  TFT_eSPI* prevTarget = NULL;
+  int16_t prevOriginX = uiParent->originX;
+  int16_t prevOriginY = uiParent->originY;
+  bool prevClip = uiParent->clipActive;
+  int16_t originY = listY;  // Screen Y of the viewport top in the draw target
+
+  if (scrollSprite != NULL) {
+    if ((!kineticRedraw) && (delta != 0) && (abs (delta) < viewHeight)) {
+      scrollSprite->scroll (0, -delta); // Move what is already drawn
+    }
+    if (kineticRedraw) {
+      scrollSprite->fillSprite (itemBgColor); // Clear the area below the last item
+    }
+
+    // The rows are drawn in sprite coordinates; the origin and clip are applied on the push
+    prevTarget = uiParent->setDrawTarget (scrollSprite);
+    uiParent->clipActive = false;
+    uiParent->setOrigin (0, 0);
+    originY = 0;
+  }
+  else {
+    // Without a buffer, the old pixels can not be moved, so every visible row is drawn
+    bandTop = 0;
+    bandBottom = viewHeight;
+    uiParent->setViewport (listX, listY, itemWidth, viewHeight, false); // Clip only
+  }
+
+  if (bandBottom > bandTop) {
+    int first = (scrollOffset + bandTop) / itemHeight;
+    int last = (scrollOffset + bandBottom - 1) / itemHeight;
+
+    for (int i = first; (i <= last) && (i < itemCount); i++) {
+      drawRow (i, originY + (i * itemHeight) - scrollOffset);
+    }
+  }
+
+  // Redraw the rows whose focus state changed, if they are visible and not drawn already
+  int focusRows [2] = {kineticFocusPrev, currentItem};
+
+  for (int k = 0; (k < 2) && (kineticFocusPrev >= 0); k++) {
+    int i = focusRows [k];
+    int32_t rowTop = ((int32_t) i * itemHeight) - scrollOffset;
+
+    if ((i < itemCount) && (rowTop + itemHeight > 0) && (rowTop < viewHeight)) {
+      drawRow (i, originY + rowTop);
+    }
+  }
+
+  if (scrollSprite != NULL) {
+    uiParent->setDrawTarget (prevTarget);
+    uiParent->setOrigin (prevOriginX, prevOriginY);
+    uiParent->clipActive = prevClip;
+
+    // Push through the draw target, so the list lands in the right place when the page
+    // is drawn into a sprite, as in a transition. The sprite holds the pixels in the byte
+    // order of the LCD, as pushSprite() expects.
+    TFT_eSPI* lcd = uiParent->lcdParent;
+    bool swap = lcd->getSwapBytes();
+
+    uiParent->setViewport (listX, listY, itemWidth, viewHeight);
+    lcd->setSwapBytes (false);
+    lcd->pushImage (0, 0, itemWidth, viewHeight, (uint16_t*) scrollSprite->getPointer());
+    lcd->setSwapBytes (swap);
+    uiParent->resetViewport();
+    CSEUI_PROFILE_CALL (itemWidth * viewHeight);
+  }
+  else {
+    uiParent->resetViewport();
+  }
+
+  drawnOffset = scrollOffset;
+  kineticRedraw = false;
+  kineticFocusPrev = -1;
+  scrollPosition = scrollOffset / itemHeight;
+  currentVisibleItem = currentItem - scrollPosition;
+}
 
 //============================================================================================//
@@ -0,0 +1,205 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Pages.cpp
+  Description: Page management source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 05:58:37 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+/**
+ * @brief Adds a page to the UI so that it can be shown with showPage(). The page is not
+ * initialized until it is first shown.
+ * 
+ * @param page The page.
+ * @return true The page was added.
+ * @return false The page, or another page with the same number, was already added.
+ */
+bool CSE_UI:: addPage (pageClass* page) {
+  if (getPage (page->pageNum) != NULL) return false;
+
+  page->nextPage = NULL;
+
+  if (firstPage == NULL) {
+    firstPage = page;
+    return true;
+  }
+
+  pageClass* last = firstPage;
+
+  while (last->nextPage != NULL) {
+    last = last->nextPage;
+  }
+  last->nextPage = page;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Finds a page added with addPage().
+ * 
+ * @param pageNum The page number.
+ * @return pageClass* The page, or NULL if there is no such page.
+ */
+pageClass* CSE_UI:: getPage (int pageNum) {
+  for (pageClass* p = firstPage; p != NULL; p = p->nextPage) {
+    if (p->pageNum == pageNum) return p;
+  }
+  return NULL;
+}
+
+//============================================================================================//
+/**
+ * @brief Switches to a page. The current page is deactivated but keeps its widgets, so
+ * going back to it is fast. The new page is initialized if it was never shown or was
+ * evicted. Before its arena is allocated, pages are evicted, least recently used first,
+ * until the arenas and the new arena fit in the page budget, so the peak stays within
+ * the budget. Only with a transition is the page being left kept until the transition
+ * is done, and evicted afterwards if the budget is still exceeded.
+ * 
+ * If a transition is given and a transition object was set with setTransition(), the
+ * change is animated and the new page is completely drawn when this returns.
+ * 
+ * currentPage and prevPage are updated, so draw functions that compare them keep working.
+ * An open dialog is closed first, since its buttons would no longer be drawn.
+ * 
+ * @param pageNum The page number.
+ * @param transition One of the CSEUI_TRANSITION_xxx values.
+ * @param duration Length of the transition in milliseconds.
+ * @return true The page is now shown.
+ * @return false There is no such page.
+ */
+bool CSE_UI:: showPage (int pageNum, uint8_t transition, uint16_t duration) {
+  pageClass* page = getPage (pageNum);
+
+  if (page == NULL) return false;
+
+  page->lastUsed = ++pageUseCounter;
+
+  if (page == activePage) return true;
+
+  pageClass* from = activePage;
+  bool animate = (from != NULL) && (pageTransition != NULL) && (transition != CSEUI_TRANSITION_NONE);
+
+  if (modalDialog != NULL) {
+    modalDialog->close(); // Restores the page being left, so a transition starts from it
+  }
+
+  if (from != NULL) {
+    from->setInactive();
+  }
+  activePage = page;
+
+  if ((focusWidget != NULL) && (!page->ownsWidget (focusWidget))) {
+    focusWidget = NULL; // It was on the page being left
+  }
+
+  if (!page->initialized) {
+    if (page->getMemory() == 0) { // Make room before the arena is allocated
+      trimPages (page->getArenaSize(), animate ? from : NULL);  // The transition draws the page being left
+    }
+    page->init();
+  }
+
+  if (animate) {
+    pageTransition->run (from, page, transition, duration);
+  }
+  else {
+    page->setActive();
+  }
+  prevPage = currentPage;
+  currentPage = pageNum;
+
+  trimPages();
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the transition object used by showPage() for animated page changes.
+ * 
+ * @param transition A transition object that was started with begin(), or NULL.
+ */
+void CSE_UI:: setTransition (transitionClass* transition) {
+  pageTransition = transition;
+}
+
+//============================================================================================//
+/**
+ * @brief Draws the page shown with showPage().
+ * 
+ * @return true A page was drawn.
+ * @return false No page is shown.
+ */
+bool CSE_UI:: drawPage() {
+  if (activePage == NULL) return false;
+  return activePage->draw();
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the most RAM the page arenas may hold. Inactive pages are evicted, least
+ * recently used first, when the budget is exceeded. The active page is never evicted.
+ * 
+ * @param bytes The budget in bytes, or 0 for no limit.
+ */
+void CSE_UI:: setPageBudget (size_t bytes) {
+  pageBudget = bytes;
+  trimPages();
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the RAM held by the arenas of all pages.
+ * 
+ * @return size_t Bytes.
+ */
+size_t CSE_UI:: getPageMemory() {
+  size_t total = 0;
+
+  for (pageClass* p = firstPage; p != NULL; p = p->nextPage) {
+    total += p->getMemory();
+  }
+  return total;
+}
+
+//============================================================================================//
+/**
+ * @brief Evicts inactive pages, least recently used first, until the page arenas fit in
+ * the page budget.
+ * 
+ * @param reserve Bytes about to be allocated for a page arena, counted with the arenas.
+ * @param keep A page that must not be evicted besides the active page, or NULL.
+ */
+void CSE_UI:: trimPages (size_t reserve, pageClass* keep) {
+  if (pageBudget == 0) return;
+
+  size_t total = getPageMemory() + reserve;
+
+  while (total > pageBudget) {
+    pageClass* oldest = NULL;
+
+    for (pageClass* p = firstPage; p != NULL; p = p->nextPage) {
+      if ((p == activePage) || (p == keep) || (p->getMemory() == 0)) continue;
+
+      if ((oldest == NULL) || (p->lastUsed < oldest->lastUsed)) {
+        oldest = p;
+      }
+    }
+
+    if (oldest == NULL) return; // Only the pages in use are left
+
+    total -= oldest->getMemory();
+    oldest->evict();
+  }
+}
+
+//============================================================================================//
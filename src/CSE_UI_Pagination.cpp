@@ -9,7 +9,7 @@
   Version: 0.0.8
   License: MIT
   Source: https://github.com/CIRCUITSTATE/CSE_CST328
-  Last Modified: +05:30 01:07:12 AM 02-03-2025, Sunday
+  Last Modified: +05:30 06:27:50 AM 21-10-2026, Wednesday
  */
 //============================================================================================//
 
@@ -25,6 +25,7 @@
  */
 paginationClass:: paginationClass (CSE_UI* ui) : button (ui) {
   uiParent = ui;
+  widgetType = CSEUI_WIDGET_PAGINATION;
 }
 
 //============================================================================================//
@@ -47,7 +48,7 @@ void paginationClass:: initialize (int x, int y, int w, int h, int max, uint16_t
   maxValue = max;
   startValue = 1;
   currentValue = 1;
-  button.labelString = String (currentValue) + "/" + String (maxValue);
+  updateLabel();
 }
 
 //============================================================================================//
@@ -95,6 +96,7 @@ void paginationClass:: disable() {
  * 
  */
 void paginationClass:: draw() {
+  CSEUI_PROFILE_SCOPE ("pagination");
   button.draw();
 }
 
@@ -109,8 +111,7 @@ void paginationClass:: setCurrentValue (int value) {
     return;
   }
   currentValue = value;
-  button.labelString = String (currentValue) + "/" + String (maxValue);
-  button.updateState (true);
+  updateLabel();
 }
 
 //============================================================================================//
@@ -134,8 +135,7 @@ void paginationClass:: setMaxValue (int value) {
     return;
   }
   maxValue = value;
-  button.labelString = String (currentValue) + "/" + String (maxValue);
-  button.updateState (true);
+  updateLabel();
 }
 
 //============================================================================================//
@@ -179,8 +179,7 @@ int paginationClass:: getStartValue() {
 void paginationClass:: increment() {
   if (currentValue < maxValue) {
     currentValue++;
-    button.labelString = String (currentValue) + "/" + String (maxValue);
-    button.updateState (true);
+    updateLabel();
   }
 }
 
@@ -192,8 +191,7 @@ void paginationClass:: increment() {
 void paginationClass:: decrement() {
   if (currentValue > startValue) {
     currentValue--;
-    button.labelString = String (currentValue) + "/" + String (maxValue);
-    button.updateState (true);
+    updateLabel();
   }
 }
 
@@ -204,8 +202,44 @@ void paginationClass:: decrement() {
  */
 void paginationClass:: reset() {
   currentValue = startValue;
-  button.labelString = String (currentValue) + "/" + String (maxValue);
-  button.updateState (true);
+  updateLabel();
+  button.updateState (true); // Redraw even if the value did not change
+}
+
+//============================================================================================//
+
+void paginationClass:: invalidate() {
+  button.invalidate();
+}
+
+//============================================================================================//
+
+bool paginationClass:: isDirty() {
+  return button.isDirty();
+}
+
+//============================================================================================//
+
+bool paginationClass:: getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  return button.getBounds (x, y, w, h);
+}
+
+//============================================================================================//
+
+bool paginationClass:: getOpaqueBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  return button.getOpaqueBounds (x, y, w, h);
+}
+
+//============================================================================================//
+/**
+ * @brief Formats the label as "currentValue/maxValue" without String temporaries. The
+ * button is redrawn only if the label changed.
+ * 
+ */
+void paginationClass:: updateLabel() {
+  char buffer [24];
+  snprintf (buffer, sizeof (buffer), "%d/%d", currentValue, maxValue);
+  button.setLabel (buffer);
 }
 
 //============================================================================================//
@@ -0,0 +1,293 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Profiler.cpp
+  Description: Draw profiler source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 01:46:03 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+/**
+ * @brief Prints a number right-aligned in a column of the given width.
+ * 
+ */
+static void printColumn (Print& out, uint64_t value, int width) {
+  char buffer [21];
+  int len = 0;
+
+  do { // Convert in reverse
+    buffer [len++] = '0' + (value % 10);
+    value /= 10;
+  } while (value > 0);
+
+  for (int i = len; i < width; i++) {
+    out.print (' ');
+  }
+  while (len > 0) {
+    out.print (buffer [--len]);
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Prints the draw profile. Without CSEUI_ENABLE_PROFILER, only a note is printed.
+ * 
+ * @param topN Number of widgets to list, most expensive first.
+ * @param out The output, such as Serial.
+ */
+void CSE_UI:: printProfile (uint8_t topN, Print& out) {
+#if defined(CSEUI_ENABLE_PROFILER)
+  profiler.print (topN, out);
+#else
+  (void) topN;
+  out.println (F("CSEUI_PROFILE disabled; define CSEUI_ENABLE_PROFILER"));
+#endif
+}
+
+//============================================================================================//
+
+#if defined(CSEUI_ENABLE_PROFILER)
+
+//============================================================================================//
+
+profilerClass:: profilerClass() {
+  reset();
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the current time in profiler units; CPU cycles on ESP32 and
+ * microseconds elsewhere.
+ * 
+ * @return uint32_t 
+ */
+uint32_t profilerClass:: now() {
+#if defined(ARDUINO_ARCH_ESP32)
+  return ESP.getCycleCount();
+#else
+  return micros();
+#endif
+}
+
+//============================================================================================//
+/**
+ * @brief Clears all records and frame statistics.
+ * 
+ */
+void profilerClass:: reset() {
+  recordCount = 0;
+  current = NULL;
+  frameStart = 0;
+  excluded = 0;
+  frames = 0;
+  frameCalls = 0;
+  framePixels = 0;
+  totalCalls = 0;
+  totalPixels = 0;
+  frameTimes.reset();
+}
+
+//============================================================================================//
+/**
+ * @brief Finds the record of a widget, adding one if needed.
+ * 
+ * @param widget The widget instance.
+ * @param type Widget type name.
+ * @return widgetRecord* The record, or NULL if the table is full.
+ */
+profilerClass::widgetRecord* profilerClass:: find (const void* widget, const char* type) {
+  for (int i = 0; i < recordCount; i++) {
+    if (records [i].widget == widget) {
+      return &records [i];
+    }
+  }
+
+  if (recordCount >= CSEUI_PROFILER_MAX_WIDGETS) {
+    return NULL;
+  }
+
+  widgetRecord* r = &records [recordCount++];
+  r->widget = widget;
+  r->type = type;
+  r->draws = 0;
+  r->redraws = 0;
+  r->cycles = 0;
+  r->pixels = 0;
+  r->calls = 0;
+  return r;
+}
+
+//============================================================================================//
+/**
+ * @brief Counts one TFT_eSPI call for the innermost widget being drawn.
+ * 
+ * @param pixels Pixels pushed by the call.
+ */
+void profilerClass:: addCall (uint32_t pixels) {
+  if (current != NULL) {
+    current->calls++;
+    current->pixels += pixels;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Counts one text drawing call for the innermost widget being drawn. The pixels
+ * are the width of the text times the given height. Measuring the text is not free, so
+ * the time it takes is taken out of the time of every widget being drawn.
+ * 
+ * @param lcd The display the text was drawn with, using its current font.
+ * @param text The drawn text.
+ * @param height Height of the text in pixels.
+ */
+void profilerClass:: addText (TFT_eSPI* lcd, const String& text, int16_t height) {
+  uint32_t t = now();
+  addCall ((uint32_t) lcd->textWidth (text) * height);
+  excluded += now() - t;
+}
+
+//============================================================================================//
+
+void profilerClass:: addText (TFT_eSPI* lcd, const char* text, int16_t height) {
+  uint32_t t = now();
+  addCall ((uint32_t) lcd->textWidth (text) * height);
+  excluded += now() - t;
+}
+
+//============================================================================================//
+
+void profilerClass:: beginFrame() {
+  frameStart = micros();
+  frameCalls = 0;
+  framePixels = 0;
+}
+
+//============================================================================================//
+
+void profilerClass:: endFrame() {
+  frameTimes.record (micros() - frameStart);
+  totalCalls += frameCalls;
+  totalPixels += framePixels;
+  frames++;
+}
+
+//============================================================================================//
+/**
+ * @brief Prints the frame statistics and the top N widgets by time spent in draw().
+ * 
+ *   CSEUI_PROFILE frames=<n> avg_frame_us=<us> p99_frame_us=<us> max_frame_us=<us> calls_per_frame=<n> pixels_per_frame=<n>
+ *     #  type        widget      draws    redraws  cycles        pixels      calls
+ * 
+ * Times, pixels and calls of a widget include the widgets drawn inside it. The time
+ * column is in CPU cycles on ESP32 and is labelled "cycles". On other targets it is in
+ * microseconds and is labelled "time_us".
+ * 
+ * @param topN Number of widgets to list.
+ * @param out The output, such as Serial.
+ */
+void profilerClass:: print (uint8_t topN, Print& out) {
+  out.print (F("CSEUI_PROFILE frames="));
+  out.print (frames);
+  out.print (F(" avg_frame_us="));
+  out.print (frameTimes.getAverage());
+  out.print (F(" p99_frame_us="));
+  out.print (frameTimes.getPercentile (99));
+  out.print (F(" max_frame_us="));
+  out.print (frameTimes.getMax());
+  out.print (F(" calls_per_frame="));
+  out.print ((unsigned long) (frames > 0 ? totalCalls / frames : 0));
+  out.print (F(" pixels_per_frame="));
+  out.println ((unsigned long) (frames > 0 ? totalPixels / frames : 0));
+
+#if defined(ARDUINO_ARCH_ESP32)
+  out.println (F("  #  type        widget      draws    redraws  cycles        pixels      calls"));
+#else
+  out.println (F("  #  type        widget      draws    redraws  time_us       pixels      calls"));
+#endif
+
+  bool listed [CSEUI_PROFILER_MAX_WIDGETS] = {false};
+
+  for (int n = 0; (n < topN) && (n < recordCount); n++) {
+    int best = -1;
+
+    for (int i = 0; i < recordCount; i++) { // Pick the most expensive one not listed yet
+      if ((!listed [i]) && ((best < 0) || (records [i].cycles > records [best].cycles))) {
+        best = i;
+      }
+    }
+    listed [best] = true;
+
+    const widgetRecord& r = records [best];
+    printColumn (out, n + 1, 3);
+    out.print (F("  "));
+    out.print (r.type);
+    for (int i = strlen (r.type); i < 12; i++) out.print (' ');
+    out.print (F("0x"));
+    out.print ((unsigned long) (uintptr_t) r.widget, HEX);
+    out.print (F("  "));
+    printColumn (out, r.draws, 7);
+    printColumn (out, r.redraws, 9);
+    printColumn (out, r.cycles, 14);
+    printColumn (out, r.pixels, 12);
+    printColumn (out, r.calls, 11);
+    out.println();
+  }
+}
+
+//============================================================================================//
+
+profilerClass::scope:: scope (profilerClass* p, const void* widget, const char* type) {
+  profiler = p;
+  record = p->find (widget, type);
+  parent = p->current;
+  pixels = 0;
+  calls = 0;
+  p->current = this;
+  excludedStart = p->excluded;
+  start = now();
+}
+
+//============================================================================================//
+/**
+ * @brief Adds the measurement to the widget record, and to the enclosing scope or the
+ * frame totals.
+ * 
+ */
+profilerClass::scope:: ~scope() {
+  uint32_t elapsed = (now() - start) - (profiler->excluded - excludedStart);
+
+  if (record != NULL) {
+    record->draws++;
+    record->cycles += elapsed;
+    record->pixels += pixels;
+    record->calls += calls;
+    if (calls > 0) {
+      record->redraws++;
+    }
+  }
+
+  if (parent != NULL) { // Nested widgets count towards their parent as well
+    parent->pixels += pixels;
+    parent->calls += calls;
+  }
+  else {
+    profiler->frameCalls += calls;
+    profiler->framePixels += pixels;
+  }
+
+  profiler->current = parent;
+}
+
+//============================================================================================//
+
+#endif // CSEUI_ENABLE_PROFILER
+
+//============================================================================================//
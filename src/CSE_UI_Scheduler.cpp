@@ -0,0 +1,150 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Scheduler.cpp
+  Description: Time-sliced render scheduler source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 08:31:57 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+/**
+ * @brief Draws the dirty widgets of the shown page within a time budget. The focused
+ * widget is drawn first, then the others from the highest priority down. A widget that
+ * would not fit in what is left of the budget, going by its last draw time, is left for
+ * the next tick, and its priority is raised by one for every tick it waits. A widget that
+ * has waited CSEUI_TICK_MAX_WAIT ticks is drawn even if it does not fit. So each call
+ * takes about the budget at most, and no widget waits forever.
+ * 
+ * A single widget is not split, so one widget that takes longer than the budget still
+ * makes its tick run over. At least one widget is drawn per tick.
+ * 
+ * The focused widget is drawn only if it is on the shown page, and it is checked for that
+ * before it is used.
+ * 
+ * The background and the draw function of the page run at the start of every tick. An
+ * open dialog is drawn before the widgets. Widgets are drawn through pageClass::
+ * drawWidget(), so they are clipped around the dialog and the opaque widgets above them,
+ * and skipped when nothing of them shows; a widget above one that was drawn over it is
+ * drawn again in the same or the next tick.
+ * 
+ * @param budget Microseconds to spend.
+ * @return uint16_t Dirty widgets left for the next tick.
+ */
+uint16_t CSE_UI:: tick (uint32_t budget) {
+  tickDrawn = 0;
+  tickPending = 0;
+
+  if (activePage == NULL) return 0;
+
+  uint32_t start = micros();
+  widgetClass* first = activePage->firstWidget;
+
+  activePage->drawBackground();
+
+  if ((modalDialog != NULL) && modalDialog->isDirty()) {
+    uint32_t t = micros();
+    modalDialog->draw();
+    modalDialog->drawTime = micros() - t;
+    tickDrawn++;
+  }
+
+  if (focusWidget != NULL) {
+    for (widgetClass* w = first; w != NULL; w = w->nextWidget) {
+      if (w != focusWidget) continue; // Only touched if it is on this page
+
+      if (w->isDirty()) {
+        uint32_t t = micros();
+
+        if (activePage->drawWidget (w)) {
+          w->drawTime = micros() - t;
+          tickDrawn++;
+        }
+        w->drawAge = CSEUI_TICK_DONE;
+      }
+      break;
+    }
+  }
+
+  // Widgets are visited one priority level at a time, from the highest. The level of a
+  // widget is its priority plus the ticks it has waited.
+  uint16_t level = 0xFFFF;
+
+  while (true) {
+    int32_t next = -1;
+
+    for (widgetClass* w = first; w != NULL; w = w->nextWidget) {
+      if (w->drawAge == CSEUI_TICK_DONE) continue;
+
+      uint16_t l = w->drawPriority + w->drawAge;
+
+      if ((l < level) && ((int32_t) l > next)) {
+        next = l;
+      }
+    }
+
+    if (next < 0) break;
+    level = next;
+
+    for (widgetClass* w = first; w != NULL; w = w->nextWidget) {
+      if ((w->drawAge == CSEUI_TICK_DONE) || ((w->drawPriority + w->drawAge) != level)) continue;
+
+      if (!w->isDirty()) {
+        w->drawAge = CSEUI_TICK_DONE;
+        continue;
+      }
+
+      startLatency (w); // Before the budget check, so a deferred redraw is timed from now
+
+      uint32_t elapsed = micros() - start;
+
+      // A widget that waited CSEUI_TICK_MAX_WAIT ticks is drawn even if it does not fit, so
+      // a focused widget that is dirty on every tick can not starve it
+      if ((tickDrawn > 0) && (w->drawAge < CSEUI_TICK_MAX_WAIT) && ((elapsed + w->drawTime) > budget)) {
+        if (w->drawAge < (CSEUI_TICK_DONE - 1)) {
+          w->drawAge++; // Moves it above the current level, so it is not visited again
+        }
+        tickPending++;
+        continue;
+      }
+
+      uint32_t t = micros();
+
+      if (activePage->drawWidget (w)) {
+        w->drawTime = micros() - t;
+        tickDrawn++;
+      }
+      w->drawAge = CSEUI_TICK_DONE;
+    }
+  }
+
+  for (widgetClass* w = first; w != NULL; w = w->nextWidget) {
+    if (w->drawAge == CSEUI_TICK_DONE) {
+      w->drawAge = 0;
+    }
+  }
+
+  tickTime = micros() - start;
+  return tickPending;
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the widget that tick() draws first, such as the one the user is touching
+ * or typing into. The focus is cleared when the page of the widget is released or
+ * evicted, or when showPage() switches to a page that the widget is not on.
+ * 
+ * @param widget A widget of the shown page, or NULL.
+ */
+void CSE_UI:: setFocus (widgetClass* widget) {
+  focusWidget = widget;
+}
+
+//============================================================================================//
@@ -0,0 +1,358 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Screen.cpp
+  Description: Screen file loader source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 04:21:13 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+// Little-endian fields of the screen file
+#define   SCREEN_U16(p)   ((uint16_t) ((p) [0] | ((p) [1] << 8)))
+#define   SCREEN_U32(p)   ((uint32_t) SCREEN_U16 (p) | ((uint32_t) SCREEN_U16 ((p) + 2) << 16))
+
+//============================================================================================//
+
+screenLoaderClass:: screenLoaderClass (CSE_UI* ui) {
+  uiParent = ui;
+  source = NULL;
+  pageCount = 0;
+  styleCount = 0;
+  stringCount = 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Checks the header of a screen file. Nothing else is read until a page is loaded.
+ * 
+ * @param src Byte source of the screen file.
+ * @return true The file is a screen file of a supported version.
+ * @return false The header is not valid.
+ */
+bool screenLoaderClass:: begin (byteSourceClass* src) {
+  uint8_t header [CSEUI_SCREEN_HEADER_SIZE];
+
+  source = src;
+  pageCount = 0;
+  styleCount = 0;
+  stringCount = 0;
+
+  if (!readBytes (0, header, CSEUI_SCREEN_HEADER_SIZE)) return false;
+
+  if ((header [0] != 'C') || (header [1] != 'S') || (header [2] != 'U') || (header [3] != CSEUI_SCREEN_VERSION)) {
+    source = NULL;
+    return false;
+  }
+
+  pageCount = header [4];
+  styleCount = header [5];
+  stringCount = SCREEN_U16 (header + 6);
+  return true;
+}
+
+//============================================================================================//
+
+bool screenLoaderClass:: readBytes (uint32_t offset, uint8_t* buffer, size_t length) {
+  if (source == NULL) return false;
+  return source->read (offset, buffer, length) == length;
+}
+
+//============================================================================================//
+/**
+ * @brief Reads the directory entry of a page.
+ * 
+ * @param pageNum The page number, as given in the screen file.
+ * @param entry Buffer of CSEUI_SCREEN_PAGE_SIZE bytes for the entry.
+ * @return true The page was found.
+ * @return false The file has no such page.
+ */
+bool screenLoaderClass:: findPage (int pageNum, uint8_t* entry) {
+  for (uint8_t i = 0; i < pageCount; i++) {
+    if (!readBytes (CSEUI_SCREEN_HEADER_SIZE + (i * CSEUI_SCREEN_PAGE_SIZE), entry, CSEUI_SCREEN_PAGE_SIZE)) return false;
+    if (entry [0] == pageNum) return true;
+  }
+  return false;
+}
+
+//============================================================================================//
+/**
+ * @brief Reads a style: the foreground, background, border (or focus foreground) and
+ * focus background colors. The default style and unknown styles read as white on black.
+ * 
+ * @param index The style index.
+ * @param colors Array of four colors.
+ */
+void screenLoaderClass:: readStyle (uint8_t index, uint16_t* colors) {
+  uint8_t style [CSEUI_SCREEN_STYLE_SIZE];
+  uint32_t offset = CSEUI_SCREEN_HEADER_SIZE + (pageCount * CSEUI_SCREEN_PAGE_SIZE) + (index * CSEUI_SCREEN_STYLE_SIZE);
+
+  if ((index == CSEUI_SCREEN_DEFAULT_STYLE) || (index >= styleCount) || (!readBytes (offset, style, CSEUI_SCREEN_STYLE_SIZE))) {
+    colors [0] = TFT_WHITE;
+    colors [1] = TFT_BLACK;
+    colors [2] = TFT_WHITE;
+    colors [3] = TFT_BLACK;
+    return;
+  }
+
+  for (uint8_t i = 0; i < 4; i++) {
+    colors [i] = SCREEN_U16 (style + (i * 2));
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Reads a text from the string table of the screen file.
+ * 
+ * @param id The text ID.
+ * @param str Receives the text. It is emptied if the ID is not valid.
+ * @return true The text was read.
+ * @return false The ID is not valid.
+ */
+bool screenLoaderClass:: getString (uint16_t id, String& str) {
+  str = "";
+
+  if (id >= stringCount) return false;
+
+  uint8_t field [4];
+  uint32_t offset = CSEUI_SCREEN_HEADER_SIZE + (pageCount * CSEUI_SCREEN_PAGE_SIZE) + (styleCount * CSEUI_SCREEN_STYLE_SIZE) + (id * 4);
+
+  if (!readBytes (offset, field, 4)) return false;
+
+  offset = SCREEN_U32 (field);
+
+  if (!readBytes (offset, field, 2)) return false;
+
+  uint16_t length = SCREEN_U16 (field);
+  char chunk [CSEUI_SOURCE_CHUNK_SIZE + 1];
+
+  str.reserve (length);
+  offset += 2;
+
+  while (length > 0) {
+    uint16_t count = (length < CSEUI_SOURCE_CHUNK_SIZE) ? length : CSEUI_SOURCE_CHUNK_SIZE;
+
+    if (!readBytes (offset, (uint8_t*) chunk, count)) return false;
+
+    chunk [count] = '\0';
+    str += chunk;
+    offset += count;
+    length -= count;
+  }
+  return true;
+}
+
+//============================================================================================//
+
+uint16_t screenLoaderClass:: readExtra (uint32_t offset, uint16_t index) {
+  uint8_t field [2];
+
+  if (!readBytes (offset + (index * 2), field, 2)) return 0;
+  return SCREEN_U16 (field);
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the number of arena bytes needed to load a page. Use it to size the
+ * arena, or to check that a changed screen file still fits.
+ * 
+ * @param pageNum The page number.
+ * @return size_t Bytes needed, or 0 if the page is not in the file.
+ */
+size_t screenLoaderClass:: getArenaSize (int pageNum) {
+  uint8_t entry [CSEUI_SCREEN_PAGE_SIZE];
+  uint8_t record [CSEUI_SCREEN_WIDGET_SIZE];
+
+  if (!findPage (pageNum, entry)) return 0;
+
+  uint16_t count = SCREEN_U16 (entry + 4);
+  uint32_t offset = SCREEN_U32 (entry + 8);
+  size_t size = 0;
+
+  for (uint16_t i = 0; i < count; i++) {
+    if (!readBytes (offset, record, CSEUI_SCREEN_WIDGET_SIZE)) break;
+
+    uint16_t extraCount = SCREEN_U16 (record + 16);
+
+    switch (record [0]) {
+      case CSEUI_WIDGET_BUTTON:
+        size += arenaClass:: objectSize <buttonClass>();
+        break;
+      case CSEUI_WIDGET_LIST: // The first extra value is the visible row count
+        size += arenaClass:: objectSize <listClass>();
+        if (extraCount > 1) {
+          size += (extraCount - 1) * arenaClass:: objectSize <buttonClass>();
+        }
+        break;
+      case CSEUI_WIDGET_TEXTAREA:
+        size += arenaClass:: objectSize <textAreaClass>();
+        break;
+      case CSEUI_WIDGET_STRING:
+        size += arenaClass:: objectSize <lcdString>();
+        break;
+      case CSEUI_WIDGET_PAGINATION:
+        size += arenaClass:: objectSize <paginationClass>();
+        break;
+    }
+
+    offset += CSEUI_SCREEN_WIDGET_SIZE + (extraCount * 2);
+  }
+  return size;
+}
+
+//============================================================================================//
+/**
+ * @brief Creates the widgets of a page in the arena and adds them to the page. The page
+ * background is set from the file too. Loading stops at the first widget that does not
+ * fit in the arena or can not be read. Then the widgets of the page are removed and the
+ * arena is reset, so the page is left empty instead of half loaded. Widgets added to the
+ * page in code, and other objects in the arena, are removed too.
+ * 
+ * @param page The page. Its number selects the page in the file.
+ * @param arena The arena to create the widgets in.
+ * @return true All widgets were created.
+ * @return false The page is not in the file, the file is damaged or the arena is full.
+ */
+bool screenLoaderClass:: loadPage (pageClass* page, arenaClass* arena) {
+  uint8_t entry [CSEUI_SCREEN_PAGE_SIZE];
+  uint8_t record [CSEUI_SCREEN_WIDGET_SIZE];
+
+  if (!findPage (page->pageNum, entry)) return false;
+
+  if (entry [1] & CSEUI_SCREEN_PAGE_FILL) {
+    page->bgColor = SCREEN_U16 (entry + 2);
+  }
+
+  uint16_t count = SCREEN_U16 (entry + 4);
+  uint32_t offset = SCREEN_U32 (entry + 8);
+
+  for (uint16_t i = 0; i < count; i++) {
+    widgetClass* widget = NULL;
+    uint16_t extraCount = 0;
+
+    if (readBytes (offset, record, CSEUI_SCREEN_WIDGET_SIZE)) {
+      extraCount = SCREEN_U16 (record + 16);
+      widget = createWidget (record, offset + CSEUI_SCREEN_WIDGET_SIZE, arena);
+    }
+
+    if (widget == NULL) { // Leave no half-loaded page behind
+      page->clearWidgets();
+      arena->reset();
+      return false;
+    }
+
+    widget->widgetId = SCREEN_U16 (record + 2);
+    page->addWidget (widget);
+    offset += CSEUI_SCREEN_WIDGET_SIZE + (extraCount * 2);
+  }
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Creates and initializes one widget from its record.
+ * 
+ * @param record The widget record.
+ * @param extraOffset File offset of the extra values of the record.
+ * @param arena The arena to create the widget in.
+ * @return widgetClass* The widget, or NULL if the arena is full or the type is unknown.
+ */
+widgetClass* screenLoaderClass:: createWidget (const uint8_t* record, uint32_t extraOffset, arenaClass* arena) {
+  uint8_t flags = record [1];
+  int16_t x = (int16_t) SCREEN_U16 (record + 4);
+  int16_t y = (int16_t) SCREEN_U16 (record + 6);
+  int16_t w = (int16_t) SCREEN_U16 (record + 8);
+  int16_t h = (int16_t) SCREEN_U16 (record + 10);
+  uint16_t extraCount = SCREEN_U16 (record + 16);
+  uint16_t colors [4];
+  String text;
+
+  readStyle (record [12], colors);
+  getString (SCREEN_U16 (record + 14), text);
+
+  switch (record [0]) {
+    case CSEUI_WIDGET_BUTTON: {
+      buttonClass* button = arena->create <buttonClass> (uiParent);
+
+      if (button == NULL) return NULL;
+
+      button->initialize (x, y, w, h, colors [1], colors [0], text);
+      button->borderColor = colors [2];
+
+      if (flags & CSEUI_SCREEN_BORDER) button->showBorder();
+      if (flags & CSEUI_SCREEN_NO_FILL) button->hideFill();
+      if (flags & CSEUI_SCREEN_DISABLED) button->disable();
+      if (flags & CSEUI_SCREEN_HIDDEN) button->hide();
+      return button;
+    }
+
+    case CSEUI_WIDGET_LIST: { // Extra values: visible row count, then the text ID of each row
+      listClass* list = arena->create <listClass> (uiParent);
+
+      if (list == NULL) return NULL;
+
+      list->initialize (x, y, w, h, colors [0], colors [1], colors [2], colors [3]);
+
+      if (extraCount > 1) {
+        list->reserveItems (extraCount - 1);
+      }
+
+      for (uint16_t i = 1; i < extraCount; i++) {
+        getString (readExtra (extraOffset, i), text);
+
+        if (list->addItem (text, arena) == NULL) return NULL;
+      }
+
+      int visible = (extraCount > 0) ? readExtra (extraOffset, 0) : list->itemCount;
+
+      if (visible > list->itemCount) visible = list->itemCount;  // A damaged or hand-edited file
+      if (visible < 1) visible = 1;
+      list->itemVisibleCount = visible;
+
+      if (flags & CSEUI_SCREEN_HIDDEN) list->hide();
+      return list;
+    }
+
+    case CSEUI_WIDGET_TEXTAREA: {
+      textAreaClass* area = arena->create <textAreaClass> (uiParent);
+
+      if (area == NULL) return NULL;
+
+      area->initialize (x, y, w, h, colors [0], colors [1], colors [2], "");
+      area->setText (text);
+
+      if (flags & CSEUI_SCREEN_HIDDEN) area->areaVisible = false;
+      return area;
+    }
+
+    case CSEUI_WIDGET_STRING: {
+      lcdString* str = arena->create <lcdString> (uiParent);
+
+      if (str == NULL) return NULL;
+
+      str->initialize (text, x, y, colors [0], colors [1], !(flags & CSEUI_SCREEN_HIDDEN));
+      return str;
+    }
+
+    case CSEUI_WIDGET_PAGINATION: { // Extra values: the maximum value
+      paginationClass* pagination = arena->create <paginationClass> (uiParent);
+
+      if (pagination == NULL) return NULL;
+
+      pagination->initialize (x, y, w, h, (extraCount > 0) ? readExtra (extraOffset, 0) : 1, colors [1], colors [0], colors [2]);
+
+      if (flags & CSEUI_SCREEN_BORDER) pagination->button.showBorder();
+      if (flags & CSEUI_SCREEN_HIDDEN) pagination->hide();
+      return pagination;
+    }
+  }
+  return NULL;
+}
+
+//============================================================================================//
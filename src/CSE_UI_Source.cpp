@@ -0,0 +1,160 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Source.cpp
+  Description: Byte source source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 11:58:50 PM 19-10-2026, Monday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+/**
+ * @brief Creates a byte source for data in RAM or in memory-mapped flash.
+ * 
+ * @param data Pointer to the data.
+ * @param length Length of the data in bytes.
+ */
+memorySourceClass:: memorySourceClass (const uint8_t* data, uint32_t length) {
+  this->data = data;
+  this->length = length;
+}
+
+//============================================================================================//
+
+uint32_t memorySourceClass:: size() {
+  return length;
+}
+
+//============================================================================================//
+/**
+ * @brief Reads bytes from the source.
+ * 
+ * @param offset Offset of the first byte.
+ * @param buffer Buffer to read into.
+ * @param count Number of bytes to read.
+ * @return size_t Number of bytes read. Less than count at the end of the data.
+ */
+size_t memorySourceClass:: read (uint32_t offset, uint8_t* buffer, size_t count) {
+  if (offset >= length) return 0;
+  if (count > (length - offset)) count = length - offset;
+
+  memcpy (buffer, data + offset, count);
+  return count;
+}
+
+//============================================================================================//
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+//============================================================================================//
+/**
+ * @brief Creates a byte source for an open file. The file must stay open while the
+ * source is used.
+ * 
+ * @param file A file opened for reading.
+ */
+fileSourceClass:: fileSourceClass (fs::File file) {
+  this->file = file;
+  length = file ? file.size() : 0;
+}
+
+//============================================================================================//
+
+uint32_t fileSourceClass:: size() {
+  return length;
+}
+
+//============================================================================================//
+
+size_t fileSourceClass:: read (uint32_t offset, uint8_t* buffer, size_t count) {
+  if (offset >= length) return 0;
+  if (file.position() != offset) {
+    if (!file.seek (offset)) return 0;
+  }
+  return file.read (buffer, count);
+}
+
+//============================================================================================//
+/**
+ * @brief Creates a byte source for a flash partition.
+ * 
+ * @param partition The partition, from esp_partition_find_first(), for example.
+ * @param length Length of the data. 0 uses the whole partition.
+ */
+partitionSourceClass:: partitionSourceClass (const esp_partition_t* partition, uint32_t length) {
+  this->partition = partition;
+
+  if (partition == NULL) {
+    this->length = 0;
+  }
+  else if ((length == 0) || (length > partition->size)) {
+    this->length = partition->size;
+  }
+  else {
+    this->length = length;
+  }
+}
+
+//============================================================================================//
+
+uint32_t partitionSourceClass:: size() {
+  return length;
+}
+
+//============================================================================================//
+
+size_t partitionSourceClass:: read (uint32_t offset, uint8_t* buffer, size_t count) {
+  if (offset >= length) return 0;
+  if (count > (length - offset)) count = length - offset;
+
+  if (esp_partition_read (partition, offset, buffer, count) != ESP_OK) {
+    return 0;
+  }
+  return count;
+}
+
+//============================================================================================//
+
+#elif defined(CSEUI_HOST_BUILD)
+
+//============================================================================================//
+/**
+ * @brief Creates a byte source for a file opened with fopen() in binary mode. The file
+ * must stay open while the source is used.
+ * 
+ * @param file 
+ */
+fileSourceClass:: fileSourceClass (FILE* file) {
+  this->file = file;
+  length = 0;
+
+  if (file != NULL) {
+    fseek (file, 0, SEEK_END);
+    length = ftell (file);
+  }
+}
+
+//============================================================================================//
+
+uint32_t fileSourceClass:: size() {
+  return length;
+}
+
+//============================================================================================//
+
+size_t fileSourceClass:: read (uint32_t offset, uint8_t* buffer, size_t count) {
+  if ((file == NULL) || (offset >= length)) return 0;
+  if (fseek (file, offset, SEEK_SET) != 0) return 0;
+  return fread (buffer, 1, count, file);
+}
+
+//============================================================================================//
+
+#endif
@@ -9,7 +9,7 @@
   Version: 0.0.8
   License: MIT
   Source: https://github.com/CIRCUITSTATE/CSE_CST328
-  Last Modified: +05:30 22:39:30 PM 06-05-2025, Tuesday
+  Last Modified: +05:30 05:58:37 AM 21-10-2026, Wednesday
  */
 //============================================================================================//
 
@@ -19,6 +19,7 @@
 
 lcdString:: lcdString (CSE_UI* ui) {
   uiParent = ui;
+  widgetType = CSEUI_WIDGET_STRING;
   stringX = 0;
   stringY = 0;
   currentString = " ";
@@ -30,11 +31,16 @@ lcdString:: lcdString (CSE_UI* ui) {
   stringVisibility = true;
   prevState = false;
   font = NULL;
+  datum = TL_DATUM;
+  drawnX = 0;
+  drawnY = 0;
+  drawnWidth = 0;
+  drawnHeight = 0;
 }
 
 //============================================================================================//
 
-void lcdString:: initialize (String str, int x, int y, uint16_t fcolor, uint16_t bcolor, bool visibility, const uint8_t* font) {
+void lcdString:: initialize (const String& str, int x, int y, uint16_t fcolor, uint16_t bcolor, bool visibility, const uint8_t* font) {
   stringX = x;
   stringY = y;
   currentString = str;
@@ -50,7 +56,9 @@ void lcdString:: initialize (String str, int x, int y, uint16_t fcolor, uint16_t
 
 //============================================================================================//
 
-void lcdString:: draw() {  
+void lcdString:: draw() {
+  CSEUI_PROFILE_SCOPE ("string");
+
   if ((stateChange || (!prevState)) && stringVisibility) {
     if (font) { // If a font is set, use it.
       uiParent->lcdParent->loadFont (font); // Set the font for the string
@@ -62,10 +70,13 @@ void lcdString:: draw() {
     if (prevState) { // Clear the text area with prev string
       uiParent->lcdParent->setTextColor (stringBgColor, stringBgColor);
       uiParent->lcdParent->drawString (prevString, stringX, stringY);
+      CSEUI_PROFILE_TEXT (prevString, uiParent->lcdParent->fontHeight());
     }
 
     uiParent->lcdParent->setTextColor (stringColor, stringBgColor);
     uiParent->lcdParent->drawString (currentString, stringX, stringY); // Print the current string
+    CSEUI_PROFILE_TEXT (currentString, uiParent->lcdParent->fontHeight());
+    measure (currentString, drawnX, drawnY, drawnWidth, drawnHeight); // While the font is loaded
     prevString = currentString; //previous and current strings are same now
     stateChange = false; //so that it won't drawn again
     prevState = true; //now the state is active
@@ -118,10 +129,33 @@ void lcdString:: update() {
 }
 
 //============================================================================================//
-//update the string and trigger a state change
 
-void lcdString:: update (String inputString) {
-  if (inputString != currentString) { //only update if there's a change in string value
+void lcdString:: invalidate() {
+  stateChange = true;
+}
+
+//============================================================================================//
+/**
+ * @brief Tells whether draw() would draw or clear the string.
+ * 
+ */
+bool lcdString:: isDirty() {
+  if (stringVisibility) {
+    return stateChange || (!prevState);
+  }
+  return prevState; // The string is still on the screen and has to be cleared
+}
+
+//============================================================================================//
+/**
+ * @brief Updates the string and triggers a state change. Nothing is copied if the string
+ * is unchanged. The new text is copied into the existing buffers, so updates of similar
+ * length do not allocate.
+ * 
+ * @param inputString The new string.
+ */
+void lcdString:: update (const char* inputString) {
+  if (currentString != inputString) { //only update if there's a change in string value
     prevString = currentString; //save the current string
     currentString = inputString; //update the active string
     stateChange = true; //trigger a state change to be redrawn
@@ -133,8 +167,113 @@ void lcdString:: update (String inputString) {
 
 //============================================================================================//
 
+void lcdString:: update (const String& inputString) {
+  if (inputString != currentString) {
+    prevString = currentString;
+    currentString = inputString;
+    stateChange = true;
+  }
+  else {
+    stateChange = false;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Updates the string from a temporary, taking over its buffer instead of copying.
+ * 
+ * @param inputString The new string.
+ */
+void lcdString:: update (String&& inputString) {
+  if (inputString != currentString) {
+    prevString = currentString;
+    currentString = std::move (inputString);
+    stateChange = true;
+  }
+  else {
+    stateChange = false;
+  }
+}
+
+//============================================================================================//
+
 void lcdString:: setTextDatum (uint8_t datum) {
   this->datum = datum; // Set the text alignment datum
 }
 
 //============================================================================================//
+/**
+ * @brief Finds the area a string would take when drawn at the position and datum of this
+ * object, with the font that is loaded now. Strings drawn from the baseline are given the
+ * font height above and below it, since the baseline offset depends on the font.
+ * 
+ * @param str The string.
+ * @param x Left edge.
+ * @param y Top edge.
+ * @param w Width.
+ * @param h Height.
+ */
+void lcdString:: measure (const String& str, int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  TFT_eSPI* lcd = uiParent->lcdParent;
+
+  w = lcd->textWidth (str);
+  h = lcd->fontHeight();
+  x = stringX;
+  y = stringY;
+
+  switch (datum % 3) { // Left, center or right
+    case 1: x -= w / 2; break;
+    case 2: x -= w; break;
+  }
+
+  switch (datum / 3) { // Top, middle, bottom or baseline
+    case 1: y -= h / 2; break;
+    case 2: y -= h; break;
+    case 3: y -= h; h *= 2; break;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the area the string takes on the screen, together with the area of the
+ * new string if it is about to be drawn. The new string is measured with the font that is
+ * loaded now, so if the object has its own font and the text changed, the area is not
+ * known until the next draw.
+ * 
+ * @return true The area is known.
+ * @return false The string is hidden and cleared, or the new area is not known.
+ */
+bool lcdString:: getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  bool pending = stringVisibility && (stateChange || (!prevState));
+
+  if (pending && prevState && (currentString == prevString)) {
+    pending = false; // Redrawn over itself
+  }
+
+  if (!pending) {
+    if (!prevState) return false;
+
+    x = drawnX;
+    y = drawnY;
+    w = drawnWidth;
+    h = drawnHeight;
+    return true;
+  }
+
+  if (font != NULL) return false;
+
+  measure (currentString, x, y, w, h);
+
+  if (prevState) { // The old string is cleared first
+    int16_t right = ((x + w) > (drawnX + drawnWidth)) ? (x + w) : (drawnX + drawnWidth);
+    int16_t bottom = ((y + h) > (drawnY + drawnHeight)) ? (y + h) : (drawnY + drawnHeight);
+
+    if (drawnX < x) x = drawnX;
+    if (drawnY < y) y = drawnY;
+    w = right - x;
+    h = bottom - y;
+  }
+  return true;
+}
+
+//============================================================================================//
@@ -0,0 +1,268 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Tasks.cpp
+  Description: Render/input task support source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 07:18:42 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+
+CSE_UI_Mutex:: CSE_UI_Mutex() {
+#if defined(ARDUINO_ARCH_ESP32)
+  handle = xSemaphoreCreateRecursiveMutex();
+#endif
+}
+
+//============================================================================================//
+
+CSE_UI_Mutex:: ~CSE_UI_Mutex() {
+#if defined(ARDUINO_ARCH_ESP32)
+  if (handle != NULL) {
+    vSemaphoreDelete (handle);
+  }
+#endif
+}
+
+//============================================================================================//
+
+void CSE_UI_Mutex:: lock() {
+#if defined(ARDUINO_ARCH_ESP32)
+  xSemaphoreTakeRecursive (handle, portMAX_DELAY);
+#elif defined(CSEUI_HOST_BUILD)
+  handle.lock();
+#endif
+}
+
+//============================================================================================//
+
+void CSE_UI_Mutex:: unlock() {
+#if defined(ARDUINO_ARCH_ESP32)
+  xSemaphoreGiveRecursive (handle);
+#elif defined(CSEUI_HOST_BUILD)
+  handle.unlock();
+#endif
+}
+
+//============================================================================================//
+// Task entry points
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+static void inputTaskFunction (void* param) {
+  CSE_UI* ui = (CSE_UI*) param;
+
+  while (ui->isRunningTasks()) {
+    ui->inputStep();
+    vTaskDelay (pdMS_TO_TICKS (CSEUI_INPUT_PERIOD_MS));
+  }
+  ui->exitTask();
+}
+
+static void renderTaskFunction (void* param) {
+  CSE_UI* ui = (CSE_UI*) param;
+
+  while (ui->isRunningTasks()) {
+    ui->renderStep();
+    vTaskDelay (1); // Let the idle task on this core run
+  }
+  ui->exitTask();
+}
+
+#elif defined(CSEUI_HOST_BUILD)
+
+static void inputTaskFunction (CSE_UI* ui) {
+  while (ui->isRunningTasks()) {
+    ui->inputStep();
+    std::this_thread::sleep_for (std::chrono::milliseconds (CSEUI_INPUT_PERIOD_MS));
+  }
+}
+
+static void renderTaskFunction (CSE_UI* ui) {
+  while (ui->isRunningTasks()) {
+    ui->renderStep();
+    std::this_thread::yield();
+  }
+}
+
+#endif
+
+//============================================================================================//
+/**
+ * @brief Sets the function the render task calls once per frame. This is usually the
+ * function that draws the active page.
+ * 
+ * @param func 
+ */
+void CSE_UI:: setRenderFunction (funcPtr func) {
+  renderFunction = func;
+}
+
+//============================================================================================//
+/**
+ * @brief Starts the input and render tasks. The input task samples the touch panel,
+ * and dispatches widget events. The render task draws the frames and is the only task
+ * that talks to the LCD. On targets without task support this returns false, and you
+ * should keep calling inputStep() and renderStep() from the loop.
+ * 
+ * @param inputCore The core to run the input task on (ESP32 only).
+ * @param renderCore The core to run the render task on (ESP32 only).
+ * @return true The tasks were started.
+ * @return false The tasks could not be started.
+ */
+bool CSE_UI:: beginTasks (uint8_t inputCore, uint8_t renderCore) {
+  if (tasksRunning) {
+    return true;
+  }
+
+  inputQueue.clear();
+  eventQueue.clear();
+  tasksRunning = true;
+
+#if defined(ARDUINO_ARCH_ESP32)
+  if (xTaskCreatePinnedToCore (inputTaskFunction, "CSEUI_Input", CSEUI_INPUT_TASK_STACK, this, 2, &inputTask, inputCore) != pdPASS) {
+    tasksRunning = false;
+    return false;
+  }
+  if (xTaskCreatePinnedToCore (renderTaskFunction, "CSEUI_Render", CSEUI_RENDER_TASK_STACK, this, 1, &renderTask, renderCore) != pdPASS) {
+    tasksRunning = false;
+    xSemaphoreTake (taskExit, portMAX_DELAY); // Wait for the input task to exit
+    inputTask = NULL;
+    renderTask = NULL;
+    return false;
+  }
+  return true;
+#elif defined(CSEUI_HOST_BUILD)
+  (void) inputCore;
+  (void) renderCore;
+  inputThread = std::thread (inputTaskFunction, this);
+  renderThread = std::thread (renderTaskFunction, this);
+  return true;
+#else
+  (void) inputCore;
+  (void) renderCore;
+  tasksRunning = false;
+  return false;
+#endif
+}
+
+//============================================================================================//
+/**
+ * @brief Stops the input and render tasks. The tasks finish their current step, and this
+ * returns only after both have exited, so beginTasks() can be called again right away.
+ * Do not call this from the render function or an event handler, since it would wait
+ * for its own task.
+ * 
+ */
+void CSE_UI:: endTasks() {
+  if (!tasksRunning) {
+    return;
+  }
+
+  tasksRunning = false;
+
+#if defined(ARDUINO_ARCH_ESP32)
+  xSemaphoreTake (taskExit, portMAX_DELAY);
+  xSemaphoreTake (taskExit, portMAX_DELAY);
+  inputTask = NULL;
+  renderTask = NULL;
+#elif defined(CSEUI_HOST_BUILD)
+  if (inputThread.joinable()) inputThread.join();
+  if (renderThread.joinable()) renderThread.join();
+#endif
+}
+
+//============================================================================================//
+
+bool CSE_UI:: isRunningTasks() {
+  return tasksRunning;
+}
+
+//============================================================================================//
+/**
+ * @brief Called by the input and render tasks when they stop. Tells endTasks() that the
+ * task is done, and deletes it (ESP32).
+ * 
+ */
+void CSE_UI:: exitTask() {
+#if defined(ARDUINO_ARCH_ESP32)
+  xSemaphoreGive (taskExit);
+  vTaskDelete (NULL);
+#endif
+}
+
+//============================================================================================//
+/**
+ * @brief One iteration of the input side. Samples the touch panel, decodes gestures and
+ * queues the frame for the render side if it differs from the last one, then dispatches
+ * the pending widget events. If the render side falls behind, the oldest frames are dropped.
+ * 
+ */
+void CSE_UI:: inputStep() {
+  CSE_UI_TouchFrame frame;
+  sampleTouch (frame);
+
+  if (gestureEnabled) { // The recogniser needs every sample to time long presses and flicks
+    CSE_UI_Gesture g;
+    if (gesture.update (frame, g)) {
+      queueGesture (g);
+    }
+  }
+
+  bool changed = (frame.count != lastInputFrame.count);
+
+  for (int i = 0; (!changed) && (i < frame.count); i++) {
+    changed = (frame.points [i].x != lastInputFrame.points [i].x) || (frame.points [i].y != lastInputFrame.points [i].y);
+  }
+
+  if (changed) {
+    inputQueue.pushOverwrite (frame);
+    lastInputFrame = frame;
+  }
+
+  dispatchEvents();
+}
+
+//============================================================================================//
+/**
+ * @brief One iteration of the render side. Takes the next touch frame and calls the
+ * render function while holding the state lock.
+ * 
+ */
+void CSE_UI:: renderStep() {
+  lockState();
+  startFrame (true);  // Never reads the panel; that is the input task's job
+
+  if (renderFunction != NULL) {
+    renderFunction();
+  }
+
+  endFrame();
+  unlockState();
+}
+
+//============================================================================================//
+/**
+ * @brief Locks the widget state. Hold this when changing widgets from a task other than
+ * the render task. The render task holds it for the duration of each frame.
+ * 
+ */
+void CSE_UI:: lockState() {
+  stateMutex.lock();
+}
+
+//============================================================================================//
+
+void CSE_UI:: unlockState() {
+  stateMutex.unlock();
+}
+
+//============================================================================================//
@@ -9,7 +9,7 @@
   Version: 0.0.8
   License: MIT
   Source: https://github.com/CIRCUITSTATE/CSE_CST328
-  Last Modified: +05:30 01:08:04 AM 02-03-2025, Sunday
+  Last Modified: +05:30 08:09:14 AM 21-10-2026, Wednesday
  */
 //============================================================================================//
 
@@ -19,11 +19,25 @@
 
 textAreaClass:: textAreaClass (CSE_UI* ui) {
   uiParent = ui;
+  widgetType = CSEUI_WIDGET_TEXTAREA;
+  opaque = true;
+  layoutWidth = 0;
+  layoutLineHeight = 0;
+  layoutFontId = 0;
+  layoutValid = false;
+  drawnFgColor = 0;
+  drawnBgColor = 0;
+  drawnBorderColor = 0;
+  drawnBorderThickness = 0;
+  changedX = 0;
+  changedY = 0;
+  changedWidth = 0;
+  changedHeight = 0;
 }
 
 //============================================================================================//
 
-void textAreaClass:: initialize (int x, int y, int w, int h, uint16_t fgcolor, uint16_t bgcolor, uint16_t brcolor, String n) {
+void textAreaClass:: initialize (int x, int y, int w, int h, uint16_t fgcolor, uint16_t bgcolor, uint16_t brcolor, const String& n) {
   name = n;
   areaX = x;
   areaY = y;
@@ -40,28 +54,69 @@ void textAreaClass:: initialize (int x, int y, int w, int h, uint16_t fgcolor, u
   borderThickness = 2;
   textEnabled = true;
   stateChanged = true;
+  layoutValid = false;
+  setAreaPadding(); // No padding until set
 }
 
 //============================================================================================//
 
+/**
+ * @brief Draws the text area. The whole area and its border are drawn only after a state
+ * change, a style change (colors or border thickness) or a font change. Otherwise only
+ * the lines that changed are redrawn, from the first changed character onwards.
+ * 
+ */
 void textAreaClass:: draw() {
+  CSEUI_PROFILE_SCOPE ("textarea");
+
+  changedWidth = 0;
+
   if (areaVisible) {
     if (textEnabled) {
-      if ((text != prevText) || stateChanged) { // Only redraw if the text has changed
-        // First draw the main viewport
-        uiParent->lcdParent->setViewport (areaX, areaY, areaWidth, areaHeight);
-        uiParent->lcdParent->fillScreen (areaBgColor);
-        uiParent->lcdParent->frameViewport (areaBorderColor, borderThickness);
+      bool styleChanged = (areaFgColor != drawnFgColor) || (areaBgColor != drawnBgColor) ||
+                          (areaBorderColor != drawnBorderColor) || (borderThickness != drawnBorderThickness);
+
+      if ((text != prevText) || stateChanged || styleChanged) { // Only redraw if the text has changed
+        if ((uiParent->getFontId() != layoutFontId) || (areaSecWidth != layoutWidth) || stateChanged) {
+          layoutValid = false;  // Font or size changed
+        }
+
+        bool fullRedraw = (!layoutValid) || styleChanged;
+
+        if (fullRedraw) {
+          // First draw the main viewport
+          uiParent->setViewport (areaX, areaY, areaWidth, areaHeight);
+          uiParent->lcdParent->fillScreen (areaBgColor);
+          uiParent->lcdParent->frameViewport (areaBorderColor, borderThickness);
+          CSEUI_PROFILE_CALL (areaWidth * areaHeight);
+
+          changedX = areaX;
+          changedY = areaY;
+          changedWidth = areaWidth;
+          changedHeight = areaHeight;
+          drawnFgColor = areaFgColor;
+          drawnBgColor = areaBgColor;
+          drawnBorderColor = areaBorderColor;
+          drawnBorderThickness = borderThickness;
+        }
 
         // Then draw the secondary viewport
-        uiParent->lcdParent->setViewport (areaSecX, areaSecY, areaSecWidth, areaSecHeight);
+        uiParent->setViewport (areaSecX, areaSecY, areaSecWidth, areaSecHeight);
+
+        uint16_t changedAt = layoutValid ? commonPrefix (prevText, text) : 0;
+        layoutText (changedAt);
+
+        uiParent->lcdParent->setTextColor (areaFgColor, areaBgColor);
 
-        if (text.length() > 0) {
-          uiParent->lcdParent->setTextColor (areaFgColor, areaBgColor);
-          uiParent->lcdParent->print (text);
+        if (fullRedraw) {
+          drawLines();
+        }
+        else {
+          drawChangedLines (changedAt);
         }
 
-        prevText = text;
+        drawnLines = lines; // Reuses the capacity of the vector
+        prevText = text;  // The text now on the screen
 
         if (stateChanged) {
           stateChanged = false;
@@ -79,13 +134,295 @@ void textAreaClass:: open() {
   if (areaVisible) {
     // Redraw the area if the state has changed
     // First draw the main viewport
-    uiParent->lcdParent->setViewport (areaX, areaY, areaWidth, areaHeight);
+    uiParent->setViewport (areaX, areaY, areaWidth, areaHeight);
     uiParent->lcdParent->fillScreen (areaBgColor);
     uiParent->lcdParent->frameViewport (areaBorderColor, borderThickness);
 
     // Then draw the secondary viewport
-    uiParent->lcdParent->setViewport (areaSecX, areaSecY, areaSecWidth, areaSecHeight);
+    uiParent->setViewport (areaSecX, areaSecY, areaSecWidth, areaSecHeight);
+  }
+}
+
+//============================================================================================//
+
+/**
+ * @brief Returns the number of lines in the current layout. Only the lines that fit the
+ * area are laid out.
+ * 
+ * @return int 
+ */
+int textAreaClass:: getLineCount() {
+  return lines.size();
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the number of leading bytes that two strings have in common.
+ * 
+ */
+uint16_t textAreaClass:: commonPrefix (const String& a, const String& b) {
+  const char* pa = a.c_str();
+  const char* pb = b.c_str();
+  uint16_t n = 0;
+
+  while ((pa [n] != '\0') && (pa [n] == pb [n]) && (n < 0xFFFF)) {
+    n++;
+  }
+
+  // Do not split a UTF-8 sequence
+  while ((n > 0) && ((((uint8_t) pa [n]) & 0xC0) == 0x80)) {
+    n--;
+  }
+  return n;
+}
+
+//============================================================================================//
+/**
+ * @brief Measures the character at the given position of the text with the current font.
+ * 
+ * @param pos Byte offset of the character.
+ * @param len Returns the number of bytes of the character (UTF-8).
+ * @return int16_t Width in pixels.
+ */
+int16_t textAreaClass:: glyphWidth (uint16_t pos, uint8_t* len) {
+  const char* p = text.c_str() + pos;
+  uint8_t c = p [0];
+  uint8_t n = 1;
+
+  if (c >= 0xF0) n = 4;
+  else if (c >= 0xE0) n = 3;
+  else if (c >= 0xC0) n = 2;
+
+  char glyph [5];
+
+  for (uint8_t i = 0; i < n; i++) {
+    if (p [i] == '\0') {
+      n = i;
+      break;
+    }
+    glyph [i] = p [i];
+  }
+  glyph [n] = '\0';
+
+  *len = (n > 0) ? n : 1;
+  return uiParent->lcdParent->textWidth (glyph);
+}
+
+//============================================================================================//
+/**
+ * @brief Updates the cached line breaks. Lines are broken at spaces when the next word
+ * does not fit, inside a word if the word is longer than the line, and at '\n'. Only the
+ * lines before the change are kept; the line before the changed one is laid out again as
+ * well, since a shorter word can move back to it. Layout stops at the bottom of the area.
+ * 
+ * @param changedAt Byte offset of the first character that changed since the last layout.
+ */
+void textAreaClass:: layoutText (uint16_t changedAt) {
+  uint16_t pos = 0;
+
+  if (layoutValid && (lines.size() > 0)) {
+    size_t keep = 0;
+
+    while ((keep < lines.size()) && (lines [keep].start <= changedAt)) {
+      keep++;
+    }
+    if (keep > 0) keep--; // The line that holds the change
+    if (keep > 0) keep--; // and the one before it
+
+    pos = lines [keep].start;
+    lines.erase (lines.begin() + keep, lines.end());
+  }
+  else {
+    lines.clear();
+  }
+
+  layoutWidth = areaSecWidth;
+  layoutLineHeight = uiParent->lcdParent->fontHeight();
+  layoutFontId = uiParent->getFontId();
+  layoutValid = true;
+
+  uint16_t length = text.length();
+  const char* str = text.c_str();
+
+  while ((pos < length) && ((int32_t) lines.size() * layoutLineHeight < areaSecHeight)) {
+    textLine line;
+    line.start = pos;
+    line.length = 0;
+    line.width = 0;
+
+    int16_t width = 0;
+    uint16_t breakPos = 0;  // Position after the last space, or 0 if none
+    int16_t breakWidth = 0; // Width of the line before that space
+    bool wrapped = false;
+
+    while (pos < length) {
+      if (str [pos] == '\n') {
+        line.length = pos - line.start;
+        line.width = width;
+        pos++;
+        wrapped = true;
+        break;
+      }
+
+      uint8_t charLength;
+      int16_t w = glyphWidth (pos, &charLength);
+
+      if (((width + w) > layoutWidth) && (pos > line.start)) {
+        if (breakPos > line.start) { // Break at the last space
+          line.length = breakPos - 1 - line.start;
+          line.width = breakWidth;
+          pos = breakPos;
+        }
+        else { // Break inside the word
+          line.length = pos - line.start;
+          line.width = width;
+        }
+        wrapped = true;
+        break;
+      }
+
+      if (str [pos] == ' ') {
+        breakPos = pos + 1;
+        breakWidth = width;
+      }
+
+      width += w;
+      pos += charLength;
+    }
+
+    if (!wrapped) { // Reached the end of the text
+      line.length = pos - line.start;
+      line.width = width;
+    }
+
+    lines.push_back (line);
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Draws the cached lines into the secondary viewport.
+ * 
+ */
+void textAreaClass:: drawLines() {
+  const char* str = text.c_str();
+
+  for (size_t i = 0; i < lines.size(); i++) {
+    uiParent->lcdParent->setCursor (0, i * layoutLineHeight);
+
+    for (uint16_t k = 0; k < lines [i].length; k++) {
+      uiParent->lcdParent->write (str [lines [i].start + k]);
+    }
+    CSEUI_PROFILE_CALL ((uint32_t) lines [i].width * layoutLineHeight);
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the width of a range of the text with the current font.
+ * 
+ * @param from Byte offset of the first character.
+ * @param to Byte offset after the last character.
+ * @return int16_t Width in pixels.
+ */
+int16_t textAreaClass:: rangeWidth (uint16_t from, uint16_t to) {
+  int16_t width = 0;
+  uint8_t charLength;
+
+  while (from < to) {
+    width += glyphWidth (from, &charLength);
+    from += charLength;
   }
+  return width;
+}
+
+//============================================================================================//
+/**
+ * @brief Redraws only what changed since the last draw, by comparing the new layout with
+ * the lines on the screen. Lines that are the same are skipped. In a changed line, the
+ * characters before the first changed one are kept, and only the region after it is
+ * cleared and drawn. Lines that are no longer used are cleared.
+ * 
+ * @param changedAt Byte offset of the first character that differs from the drawn text.
+ */
+void textAreaClass:: drawChangedLines (uint16_t changedAt) {
+  const char* str = text.c_str();
+  size_t count = (lines.size() > drawnLines.size()) ? lines.size() : drawnLines.size();
+
+  for (size_t i = 0; i < count; i++) {
+    int16_t y = i * layoutLineHeight;
+
+    if (i >= lines.size()) { // The text got shorter
+      uiParent->lcdParent->fillRect (0, y, drawnLines [i].width, layoutLineHeight, areaBgColor);
+      CSEUI_PROFILE_CALL ((uint32_t) drawnLines [i].width * layoutLineHeight);
+      addChanged (0, y, drawnLines [i].width, layoutLineHeight);
+      continue;
+    }
+
+    const textLine& line = lines [i];
+    uint16_t lineEnd = line.start + line.length;
+    uint16_t from = line.start; // First byte to draw
+    int16_t oldWidth = 0;
+
+    if (i < drawnLines.size()) {
+      const textLine& old = drawnLines [i];
+      oldWidth = old.width;
+
+      if (old.start == line.start) {
+        if ((old.length == line.length) && (changedAt >= lineEnd)) {
+          continue; // Unchanged line
+        }
+        if (changedAt > line.start) { // Keep the characters before the change
+          from = (changedAt < lineEnd) ? changedAt : lineEnd;
+        }
+      }
+    }
+
+    int16_t x = rangeWidth (line.start, from);
+    int16_t right = (oldWidth > line.width) ? oldWidth : line.width;
+
+    if (right > x) {
+      uiParent->lcdParent->fillRect (x, y, right - x, layoutLineHeight, areaBgColor);
+      CSEUI_PROFILE_CALL ((uint32_t) (right - x) * layoutLineHeight);
+      addChanged (x, y, right - x, layoutLineHeight);
+    }
+
+    uiParent->lcdParent->setCursor (x, y);
+
+    for (uint16_t k = from; k < lineEnd; k++) {
+      uiParent->lcdParent->write (str [k]);
+    }
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Adds a rectangle of the text viewport to the area changed by this draw.
+ * 
+ * @param x X-coordinate in the text viewport.
+ * @param y Y-coordinate in the text viewport.
+ * @param w Width.
+ * @param h Height.
+ */
+void textAreaClass:: addChanged (int16_t x, int16_t y, int16_t w, int16_t h) {
+  x += areaSecX;
+  y += areaSecY;
+
+  if (changedWidth == 0) {
+    changedX = x;
+    changedY = y;
+    changedWidth = w;
+    changedHeight = h;
+    return;
+  }
+
+  int16_t right = ((x + w) > (changedX + changedWidth)) ? (x + w) : (changedX + changedWidth);
+  int16_t bottom = ((y + h) > (changedY + changedHeight)) ? (y + h) : (changedY + changedHeight);
+
+  if (x < changedX) changedX = x;
+  if (y < changedY) changedY = y;
+  changedWidth = right - changedX;
+  changedHeight = bottom - changedY;
 }
 
 //============================================================================================//
@@ -101,10 +438,61 @@ void textAreaClass:: reset() {
   close();
 }
 
+//============================================================================================//
+/**
+ * @brief Marks the text area for a full redraw.
+ * 
+ */
+void textAreaClass:: invalidate() {
+  stateChanged = true; // Makes the next draw lay out and draw the whole area
+}
+
+//============================================================================================//
+
+bool textAreaClass:: getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  if (!areaVisible) return false;
+
+  x = areaX;
+  y = areaY;
+  w = areaWidth;
+  h = areaHeight;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the area changed by the last draw: the whole area after a full redraw,
+ * or the lines that were redrawn after a partial one.
+ * 
+ * @return true 
+ * @return false The last draw did not change anything.
+ */
+bool textAreaClass:: getChangedBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  if ((changedWidth <= 0) || (changedHeight <= 0)) return false;
+
+  x = changedX;
+  y = changedY;
+  w = changedWidth;
+  h = changedHeight;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Tells whether draw() would redraw anything, using the same checks.
+ * 
+ */
+bool textAreaClass:: isDirty() {
+  if ((!areaVisible) || (!textEnabled)) return false;
+
+  return (text != prevText) || stateChanged || (areaFgColor != drawnFgColor) || (areaBgColor != drawnBgColor) ||
+         (areaBorderColor != drawnBorderColor) || (borderThickness != drawnBorderThickness);
+}
+
 //============================================================================================//
 
 void textAreaClass:: close() {
-  uiParent->lcdParent->resetViewport();
+  uiParent->resetViewport();
 }
 
 //============================================================================================//
@@ -127,32 +515,60 @@ void textAreaClass:: disableText() {
 
 //============================================================================================//
 /**
- * @brief Set the built-in text. This does not affect manual text drawing.
+ * @brief Set the built-in text. This does not affect manual text drawing. Nothing is
+ * copied if the text is unchanged.
  * 
  * @param str 
  */
-void textAreaClass:: setText (String str) {
-  if (str != text) {
-    prevText = text;
+void textAreaClass:: setText (const char* str) {
+  if (text != str) {
     text = str;
     // stateChanged = true;
   }
 }
 
+//============================================================================================//
+
+void textAreaClass:: setText (const String& str) {
+  if (str != text) {
+    text = str;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Set the built-in text from a temporary, taking over its buffer instead of
+ * copying.
+ * 
+ * @param str 
+ */
+void textAreaClass:: setText (String&& str) {
+  if (str != text) {
+    text = std::move (str);
+  }
+}
+
 //============================================================================================//
 /**
  * @brief Append text to the built-in text. This does not affect manual text drawing.
  * 
  * @param str 
  */
-void textAreaClass:: appendText (String str) {
-  if (text != (text + str)) {
-    prevText = text;
-    text = text + str;
+void textAreaClass:: appendText (const char* str) {
+  if ((str != NULL) && (str [0] != '\0')) {
+    text += str; // Grows the buffer in place
     // stateChanged = true;
   }
 }
 
+//============================================================================================//
+
+void textAreaClass:: appendText (const String& str) {
+  if (str.length() > 0) {
+    text += str;
+  }
+}
+
 //============================================================================================//
 /**
  * @brief Clear the built-in text. This does not affect manual text drawing.
@@ -160,7 +576,6 @@ void textAreaClass:: appendText (String str) {
  */
 void textAreaClass:: clearText() {
   if (text != "") {
-    prevText = text;
     text = "";
     // stateChanged = true;
   }
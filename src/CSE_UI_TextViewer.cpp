@@ -0,0 +1,458 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_TextViewer.cpp
+  Description: Text viewer source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 08:09:14 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+
+textViewerClass:: textViewerClass (CSE_UI* ui) {
+  uiParent = ui;
+  widgetType = CSEUI_WIDGET_VIEWER;
+  opaque = true;
+  source = NULL;
+  lineCount = 0;
+  indexed = false;
+  drawnTopLine = 0;
+  drawnLineHeight = 0;
+  drawnFontId = 0;
+  topLine = 0;
+  viewerVisible = true;
+  stateChanged = true;
+}
+
+//============================================================================================//
+/**
+ * @brief Initializes the viewer. Call this after the constructor.
+ * 
+ * @param x X-coordinate of the top-left of the viewer.
+ * @param y Y-coordinate of the top-left of the viewer.
+ * @param w Width in pixels.
+ * @param h Height in pixels.
+ * @param fgcolor Text color.
+ * @param bgcolor Background color.
+ */
+void textViewerClass:: initialize (int x, int y, int w, int h, uint16_t fgcolor, uint16_t bgcolor) {
+  viewerX = x;
+  viewerY = y;
+  viewerWidth = w;
+  viewerHeight = h;
+  viewerFgColor = fgcolor;
+  viewerBgColor = bgcolor;
+  topLine = 0;
+  viewerVisible = true;
+  stateChanged = true;
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the text to show. The source is scanned on the next draw.
+ * 
+ * @param src The byte source. It must stay valid while the viewer uses it.
+ */
+void textViewerClass:: setSource (byteSourceClass* src) {
+  source = src;
+  lineIndex.clear();
+  lineCount = 0;
+  indexed = false;
+  topLine = 0;
+  stateChanged = true;
+}
+
+//============================================================================================//
+/**
+ * @brief Scans the source once, counting the lines and saving the offset of every
+ * CSEUI_VIEWER_INDEX_STEP-th line.
+ * 
+ */
+void textViewerClass:: buildIndex() {
+  lineIndex.clear();
+  lineCount = 0;
+  indexed = true;
+
+  if (source == NULL) return;
+
+  uint32_t length = source->size();
+  uint32_t offset = 0;
+  bool lineOpen = false;  // The current line has at least one byte
+  uint8_t chunk [CSEUI_SOURCE_CHUNK_SIZE];
+
+  while (offset < length) {
+    size_t n = source->read (offset, chunk, sizeof (chunk));
+
+    if (n == 0) break;
+
+    for (size_t i = 0; i < n; i++) {
+      if (!lineOpen) { // A new line starts here
+        if ((lineCount % CSEUI_VIEWER_INDEX_STEP) == 0) {
+          lineIndex.push_back (offset + i);
+        }
+        lineCount++;
+        lineOpen = true;
+      }
+      if (chunk [i] == '\n') {
+        lineOpen = false;
+      }
+    }
+    offset += n;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the offset of the start of a line, starting from the nearest indexed
+ * line before it.
+ * 
+ * @param line Line number.
+ * @return uint32_t Byte offset.
+ */
+uint32_t textViewerClass:: findLine (uint32_t line) {
+  if ((line >= lineCount) || (lineIndex.size() == 0)) return source->size();
+
+  uint32_t offset = lineIndex [line / CSEUI_VIEWER_INDEX_STEP];
+  uint32_t skip = line % CSEUI_VIEWER_INDEX_STEP; // Line breaks to pass
+  uint8_t chunk [CSEUI_SOURCE_CHUNK_SIZE];
+
+  while (skip > 0) {
+    size_t n = source->read (offset, chunk, sizeof (chunk));
+
+    if (n == 0) break;
+
+    for (size_t i = 0; i < n; i++) {
+      if (chunk [i] == '\n') {
+        skip--;
+        if (skip == 0) {
+          return offset + i + 1;
+        }
+      }
+    }
+    offset += n;
+  }
+  return offset;
+}
+
+//============================================================================================//
+/**
+ * @brief Reads one line into a buffer. Bytes after CSEUI_VIEWER_LINE_MAX are skipped,
+ * without splitting a UTF-8 character. Carriage returns are dropped.
+ * 
+ * @param offset Offset of the start of the line.
+ * @param buffer Buffer of CSEUI_VIEWER_LINE_MAX + 1 bytes. It is null-terminated.
+ * @return uint32_t Offset of the start of the next line.
+ */
+uint32_t textViewerClass:: readLine (uint32_t offset, char* buffer) {
+  uint8_t chunk [CSEUI_SOURCE_CHUNK_SIZE];
+  size_t len = 0;
+
+  while (true) {
+    size_t n = source->read (offset, chunk, sizeof (chunk));
+
+    if (n == 0) break;
+
+    for (size_t i = 0; i < n; i++) {
+      if (chunk [i] == '\n') {
+        offset += i + 1;
+        n = 0;
+        break;
+      }
+      if ((chunk [i] != '\r') && (len < CSEUI_VIEWER_LINE_MAX)) {
+        buffer [len++] = chunk [i];
+      }
+    }
+
+    if (n == 0) break;  // Found the end of the line
+    offset += n;
+  }
+
+  // Drop a UTF-8 character cut at the end of the buffer
+  if (len == CSEUI_VIEWER_LINE_MAX) {
+    size_t end = len;
+
+    while ((end > 0) && ((((uint8_t) buffer [end - 1]) & 0xC0) == 0x80)) {
+      end--;
+    }
+    if ((end > 0) && (((uint8_t) buffer [end - 1]) >= 0xC0)) {
+      uint8_t c = buffer [end - 1];
+      size_t need = (c >= 0xF0) ? 4 : ((c >= 0xE0) ? 3 : 2);
+
+      if ((len - (end - 1)) < need) {
+        len = end - 1;
+      }
+    }
+  }
+
+  buffer [len] = '\0';
+  return offset;
+}
+
+//============================================================================================//
+/**
+ * @brief Returns a 32-bit FNV-1a hash of a line, used to tell if a row has to be redrawn.
+ * It is never 0, which marks an unknown row.
+ * 
+ * @param text Null-terminated line.
+ * @return uint32_t 
+ */
+static uint32_t hashLine (const char* text) {
+  uint32_t hash = 2166136261UL;
+
+  while (*text != '\0') {
+    hash = (hash ^ (uint8_t) *text++) * 16777619UL;
+  }
+  return (hash == 0) ? 1 : hash;
+}
+
+//============================================================================================//
+/**
+ * @brief Moves the drawn rows by a number of lines, so that only the lines that scrolled
+ * in have to be drawn. The pixels are moved one row at a time with readRect() and
+ * pushRect(), so this is done only if the LCD can be read back and no clip rectangle is
+ * set; the pixels outside the clip rectangle may be covered or stale. Otherwise the rows
+ * are left alone and draw() redraws the ones whose text changed.
+ * 
+ * @param lines Lines scrolled. Positive values scroll down, moving the rows up.
+ * @param lineHeight Height of a line in pixels.
+ */
+void textViewerClass:: scrollPixels (int32_t lines, int lineHeight) {
+#if CSEUI_LCD_READABLE
+  int32_t rows = rowHash.size();
+
+  if ((lines == 0) || (lines >= rows) || (-lines >= rows)) return;
+  if (uiParent->clipActive) return;
+
+  if (rowBuffer.size() != (size_t) viewerWidth) {
+    rowBuffer.resize (viewerWidth);
+  }
+
+  TFT_eSPI* lcd = uiParent->lcdParent;
+  uint16_t* buffer = &rowBuffer [0];
+  int32_t count = (lines > 0) ? lines : -lines;
+  int32_t shift = count * lineHeight; // Pixels moved
+  int32_t height = viewerHeight - shift;  // Pixel rows moved
+
+  if (lines > 0) {
+    for (int32_t y = 0; y < height; y++) {
+      lcd->readRect (0, y + shift, viewerWidth, 1, buffer);
+      lcd->pushRect (0, y, viewerWidth, 1, buffer);
+    }
+
+    for (int32_t i = 0; i < rows; i++) {
+      rowHash [i] = ((i + count) < rows) ? rowHash [i + count] : 0;
+    }
+
+    if ((viewerHeight % lineHeight) != 0) {
+      rowHash [rows - 1 - count] = 0; // It was cut at the bottom; draw it whole
+    }
+  }
+  else {
+    for (int32_t y = height - 1; y >= 0; y--) {
+      lcd->readRect (0, y, viewerWidth, 1, buffer);
+      lcd->pushRect (0, y + shift, viewerWidth, 1, buffer);
+    }
+
+    for (int32_t i = rows - 1; i >= 0; i--) {
+      rowHash [i] = (i >= count) ? rowHash [i - count] : 0;
+    }
+  }
+
+  CSEUI_PROFILE_CALL (viewerWidth * height * 2);  // Read and written
+#else
+  (void) lines;
+  (void) lineHeight;
+#endif
+}
+
+//============================================================================================//
+/**
+ * @brief Draws the visible lines. Nothing is drawn unless the viewer was scrolled or
+ * its state changed. Each draw reads only the visible lines from the source, and redraws
+ * only the rows whose text differs from what is on the screen. A scroll of less than a
+ * screen moves the rows still visible, if the LCD can be read back.
+ * 
+ */
+void textViewerClass:: draw() {
+  CSEUI_PROFILE_SCOPE ("textviewer");
+
+  if (!viewerVisible) return;
+  if ((!stateChanged) && (topLine == drawnTopLine)) return;
+
+  if (!indexed) {
+    buildIndex();
+  }
+
+  TFT_eSPI* lcd = uiParent->lcdParent;
+  int lineHeight = lcd->fontHeight();
+  uint32_t fontId = uiParent->getFontId();
+
+  if (lineHeight <= 0) lineHeight = 1;
+
+  size_t rows = (viewerHeight + lineHeight - 1) / lineHeight; // The last one can be cut
+
+  uiParent->setViewport (viewerX, viewerY, viewerWidth, viewerHeight);
+
+  // The rows on the screen are unknown after a state or font change
+  if (stateChanged || (lineHeight != drawnLineHeight) || (fontId != drawnFontId) || (rowHash.size() != rows)) {
+    rowHash.assign (rows, 0);
+  }
+  else if (topLine != drawnTopLine) {
+    scrollPixels ((int32_t) (topLine - drawnTopLine), lineHeight);
+  }
+
+  uint8_t prevDatum = lcd->getTextDatum();
+  char buffer [CSEUI_VIEWER_LINE_MAX + 1];
+  uint32_t offset = 0;
+
+  if ((source != NULL) && (topLine < lineCount)) {
+    offset = findLine (topLine);
+  }
+
+  lcd->setTextDatum (TL_DATUM);
+  lcd->setTextColor (viewerFgColor, viewerBgColor);
+
+  for (size_t row = 0; row < rows; row++) {
+    uint32_t line = topLine + row;
+
+    buffer [0] = '\0';
+
+    if ((source != NULL) && (line < lineCount)) {
+      offset = readLine (offset, buffer);
+    }
+
+    uint32_t hash = hashLine (buffer);
+
+    if (hash == rowHash [row]) continue;  // Already on the screen
+
+    lcd->fillRect (0, row * lineHeight, viewerWidth, lineHeight, viewerBgColor);
+    CSEUI_PROFILE_CALL (viewerWidth * lineHeight);
+
+    if (buffer [0] != '\0') {
+      lcd->drawString (buffer, 0, row * lineHeight);
+      CSEUI_PROFILE_TEXT (buffer, lineHeight);
+    }
+
+    rowHash [row] = hash;
+  }
+
+  lcd->setTextDatum (prevDatum);
+  uiParent->resetViewport();
+
+  drawnTopLine = topLine;
+  drawnLineHeight = lineHeight;
+  drawnFontId = fontId;
+  stateChanged = false;
+}
+
+//============================================================================================//
+/**
+ * @brief Triggers a redraw, for example after the page was cleared.
+ * 
+ */
+void textViewerClass:: reset() {
+  stateChanged = true;
+}
+
+//============================================================================================//
+
+void textViewerClass:: invalidate() {
+  stateChanged = true;
+}
+
+//============================================================================================//
+
+bool textViewerClass:: getBounds (int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+  if (!viewerVisible) return false;
+
+  x = viewerX;
+  y = viewerY;
+  w = viewerWidth;
+  h = viewerHeight;
+  return true;
+}
+
+//============================================================================================//
+
+bool textViewerClass:: isDirty() {
+  return viewerVisible && (stateChanged || (topLine != drawnTopLine));
+}
+
+//============================================================================================//
+
+void textViewerClass:: show() {
+  viewerVisible = true;
+  stateChanged = true;
+}
+
+//============================================================================================//
+
+void textViewerClass:: hide() {
+  viewerVisible = false;
+}
+
+//============================================================================================//
+/**
+ * @brief Scrolls so that the given line is at the top. The last page of the text is the
+ * furthest it scrolls.
+ * 
+ * @param line Line number.
+ */
+void textViewerClass:: scrollTo (uint32_t line) {
+  uint32_t count = getLineCount();
+  uint32_t visible = getVisibleLineCount();
+  uint32_t maxTop = (count > visible) ? (count - visible) : 0;
+
+  topLine = (line > maxTop) ? maxTop : line;
+}
+
+//============================================================================================//
+/**
+ * @brief Scrolls by a number of lines. Negative values scroll up.
+ * 
+ * @param lines 
+ */
+void textViewerClass:: scrollBy (int32_t lines) {
+  if ((lines < 0) && ((uint32_t) (-lines) > topLine)) {
+    scrollTo (0);
+  }
+  else {
+    scrollTo (topLine + lines);
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the number of lines in the text. Scans the source if it was not scanned
+ * yet.
+ * 
+ * @return uint32_t 
+ */
+uint32_t textViewerClass:: getLineCount() {
+  if (!indexed) {
+    buildIndex();
+  }
+  return lineCount;
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the number of lines that fit the viewer with the current font.
+ * 
+ * @return uint32_t 
+ */
+uint32_t textViewerClass:: getVisibleLineCount() {
+  int lineHeight = uiParent->lcdParent->fontHeight();
+
+  if (lineHeight <= 0) return 0;
+  return viewerHeight / lineHeight;
+}
+
+//============================================================================================//
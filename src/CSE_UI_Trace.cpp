@@ -0,0 +1,268 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Trace.cpp
+  Description: Touch trace recording and replay source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 05:48:36 PM 19-10-2026, Monday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+
+touchRecorderClass:: touchRecorderClass() {
+  output = NULL;
+  recording = false;
+  lastTime = 0;
+  lastFrame.count = 0;
+  frames = 0;
+  bytes = 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Starts a new trace. The header is written immediately.
+ * 
+ * @param out Where to write the trace, such as a File or Serial.
+ */
+void touchRecorderClass:: begin (Print& out) {
+  output = &out;
+  frames = 0;
+  bytes = 0;
+  lastFrame.count = 0;
+  lastTime = micros();
+
+  writeByte ('C');
+  writeByte ('S');
+  writeByte ('T');
+  writeByte ('T');
+  writeByte (CSEUI_TRACE_VERSION);
+  writeByte (CSEUI_TOUCH_MAX_POINTS);
+
+  recording = true;
+}
+
+//============================================================================================//
+/**
+ * @brief Stops recording. The trace is complete as it is; there is no trailer.
+ * 
+ */
+void touchRecorderClass:: end() {
+  recording = false;
+}
+
+//============================================================================================//
+
+bool touchRecorderClass:: isRecording() {
+  return recording;
+}
+
+//============================================================================================//
+
+void touchRecorderClass:: writeByte (uint8_t b) {
+  output->write (b);
+  bytes++;
+}
+
+//============================================================================================//
+/**
+ * @brief Records a raw touch frame if it differs from the previous one.
+ * 
+ * @param frame The frame.
+ */
+void touchRecorderClass:: record (const CSE_UI_TouchFrame& frame) {
+  if (!recording) return;
+
+  bool changed = (frame.count != lastFrame.count);
+
+  for (int i = 0; (!changed) && (i < frame.count); i++) {
+    const CSE_UI_TouchPoint& a = frame.points [i];
+    const CSE_UI_TouchPoint& b = lastFrame.points [i];
+    changed = (a.id != b.id) || (a.x != b.x) || (a.y != b.y) || (a.z != b.z);
+  }
+
+  if ((!changed) && (frames > 0)) return;
+
+  uint32_t delta = frame.timestamp - lastTime;
+
+  do { // Time delta as a varint
+    uint8_t b = delta & 0x7F;
+    delta >>= 7;
+    writeByte (delta ? (b | 0x80) : b);
+  } while (delta);
+
+  writeByte (frame.count);
+
+  for (int i = 0; i < frame.count; i++) {
+    const CSE_UI_TouchPoint& p = frame.points [i];
+    writeByte (p.id);
+    writeByte (p.x & 0xFF);
+    writeByte ((p.x >> 8) & 0xFF);
+    writeByte (p.y & 0xFF);
+    writeByte ((p.y >> 8) & 0xFF);
+    writeByte ((p.z < 0) ? 0 : ((p.z > 255) ? 255 : p.z));
+  }
+
+  lastFrame = frame;
+  lastTime = frame.timestamp;
+  frames++;
+}
+
+//============================================================================================//
+
+touchReplayClass:: touchReplayClass() {
+  data = NULL;
+  length = 0;
+  position = 0;
+  startTime = 0;
+  traceTime = 0;
+  realTime = true;
+  current.count = 0;
+}
+
+//============================================================================================//
+/**
+ * @brief Starts replaying a trace from memory.
+ * 
+ * @param trace The trace data, including the header.
+ * @param len Length of the trace in bytes.
+ * @param realtime If true, frames are returned at their recorded times. If false, each
+ * read returns the next record.
+ * @return true The trace header is valid.
+ * @return false The data is not a supported trace.
+ */
+bool touchReplayClass:: begin (const uint8_t* trace, uint32_t len, bool realtime) {
+  data = NULL;
+
+  if ((trace == NULL) || (len < CSEUI_TRACE_HEADER_SIZE)) return false;
+  if ((trace [0] != 'C') || (trace [1] != 'S') || (trace [2] != 'T') || (trace [3] != 'T')) return false;
+  if (trace [4] != CSEUI_TRACE_VERSION) return false;
+
+  data = trace;
+  length = len;
+  realTime = realtime;
+  rewind();
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Restarts the replay from the first record.
+ * 
+ */
+void touchReplayClass:: rewind() {
+  position = CSEUI_TRACE_HEADER_SIZE;
+  startTime = micros();
+  traceTime = 0;
+  current.count = 0;
+}
+
+//============================================================================================//
+
+bool touchReplayClass:: isFinished() {
+  return (data == NULL) || (position >= length);
+}
+
+//============================================================================================//
+/**
+ * @brief Decodes the record at the read position without consuming it.
+ * 
+ * @param frame The decoded frame.
+ * @param delta Time of the record since the previous one, in microseconds.
+ * @return true A complete record was decoded.
+ * @return false The trace has ended or is truncated.
+ */
+bool touchReplayClass:: readRecord (CSE_UI_TouchFrame& frame, uint32_t& delta) {
+  uint32_t pos = position;
+  uint8_t shift = 0;
+  delta = 0;
+
+  while (pos < length) {
+    uint8_t b = data [pos++];
+    delta |= (uint32_t) (b & 0x7F) << shift;
+    shift += 7;
+    if ((b & 0x80) == 0) break;
+  }
+
+  if (pos >= length) return false;
+
+  uint8_t count = data [pos++];
+
+  if ((count > CSEUI_TOUCH_MAX_POINTS) || ((pos + (count * 6UL)) > length)) return false;
+
+  frame.count = count;
+
+  for (int i = 0; i < count; i++) {
+    frame.points [i].id = data [pos];
+    frame.points [i].x = (int16_t) (data [pos + 1] | (data [pos + 2] << 8));
+    frame.points [i].y = (int16_t) (data [pos + 3] | (data [pos + 4] << 8));
+    frame.points [i].z = data [pos + 5];
+    pos += 6;
+  }
+
+  position = pos; // Tentative; restored by the caller if the record is not due yet
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Reads the raw frame that is due now. The points and count of the frame are
+ * replaced, the timestamp is left as it is.
+ * 
+ * @param frame The frame to fill.
+ * @return true The trace is still playing.
+ * @return false The trace has ended; the frame has no points.
+ */
+bool touchReplayClass:: read (CSE_UI_TouchFrame& frame) {
+  if (isFinished()) {
+    frame.count = 0;
+    return false;
+  }
+
+  CSE_UI_TouchFrame next;
+  uint32_t delta;
+
+  if (realTime) {
+    uint32_t elapsed = micros() - startTime;
+
+    while (true) { // Apply every record that is due by now
+      uint32_t start = position;
+
+      if (!readRecord (next, delta)) {
+        position = length; // Truncated; stop here
+        break;
+      }
+      if ((traceTime + delta) > elapsed) {
+        position = start; // Not due yet
+        break;
+      }
+      traceTime += delta;
+      current = next;
+    }
+  }
+  else {
+    if (readRecord (next, delta)) {
+      traceTime += delta;
+      current = next;
+    }
+    else {
+      position = length;
+    }
+  }
+
+  frame.count = current.count;
+
+  for (int i = 0; i < current.count; i++) {
+    frame.points [i] = current.points [i];
+  }
+
+  return !isFinished() || (current.count > 0);
+}
+
+//============================================================================================//
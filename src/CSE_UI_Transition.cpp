@@ -0,0 +1,289 @@
+//============================================================================================//
+/*
+  Filename: CSE_UI_Transition.cpp
+  Description: Page transition source file for the CSE_UI Arduino library.
+  Framework: Arduino, PlatformIO
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 08:16:40 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "CSE_UI.h"
+
+//============================================================================================//
+
+transitionClass:: transitionClass (CSE_UI* ui) {
+  uiParent = ui;
+  stripOut = NULL;
+  stripIn = NULL;
+  screenWidth = 0;
+  screenHeight = 0;
+  stripHeight = CSEUI_TRANSITION_DEF_STRIP_HEIGHT;
+  targetFps = CSEUI_TRANSITION_DEF_FPS;
+  framesDrawn = 0;
+  framesSkipped = 0;
+  runTime = 0;
+}
+
+//============================================================================================//
+
+transitionClass:: ~transitionClass() {
+  end();
+}
+
+//============================================================================================//
+/**
+ * @brief Allocates the two strip buffers of screen width x strip height pixels.
+ * 
+ * @param strip Rows composed and pushed at once. Taller strips mean fewer LCD transfers
+ * and fewer page redraws per frame, but need more RAM.
+ * @return true The buffers were allocated.
+ * @return false Not enough memory.
+ */
+bool transitionClass:: begin (uint16_t strip) {
+  end();
+
+  TFT_eSPI* lcd = uiParent->lcdParent;
+
+  lcd->resetViewport();
+  screenWidth = lcd->width();
+  screenHeight = lcd->height();
+  stripHeight = strip;
+
+  stripOut = new TFT_eSprite (lcd);
+  stripIn = new TFT_eSprite (lcd);
+  stripOut->setColorDepth (16);
+  stripIn->setColorDepth (16);
+
+  if ((stripOut->createSprite (screenWidth, stripHeight) == NULL) || (stripIn->createSprite (screenWidth, stripHeight) == NULL)) {
+    end();
+    return false;
+  }
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Frees the strip buffers.
+ * 
+ */
+void transitionClass:: end() {
+  if (stripOut != NULL) {
+    stripOut->deleteSprite();
+    delete stripOut;
+    stripOut = NULL;
+  }
+
+  if (stripIn != NULL) {
+    stripIn->deleteSprite();
+    delete stripIn;
+    stripIn = NULL;
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Changes from one page to another with an animation. The old page is deactivated
+ * and the new one activated. When this returns, the new page is completely on the screen.
+ * 
+ * @param from The page on the screen.
+ * @param to The page to show. It must be initialized.
+ * @param type One of the CSEUI_TRANSITION_xxx values.
+ * @param duration Length of the transition in milliseconds.
+ * @return true The transition was shown.
+ * @return false The buffers are not allocated.
+ */
+bool transitionClass:: run (pageClass* from, pageClass* to, uint8_t type, uint16_t duration) {
+  if ((stripOut == NULL) || (from == NULL) || (to == NULL)) return false;
+
+  from->setInactive();
+  to->setActive();
+
+  uint32_t interval = 1000000UL / targetFps;
+  uint32_t total = (uint32_t) duration * 1000UL;
+  uint32_t start = micros();
+  uint32_t nextFrame = 0;
+
+  framesDrawn = 0;
+  framesSkipped = 0;
+
+  while (true) {
+    uint32_t elapsed = micros() - start;
+
+    if (elapsed >= total) break;
+
+    if (elapsed < nextFrame) { // Ahead of the target frame rate
+      if ((nextFrame - elapsed) >= 1000) {
+        delay ((nextFrame - elapsed) / 1000);
+      }
+      continue;
+    }
+
+    drawFrame (from, to, type, (uint16_t) (((uint64_t) elapsed * 256) / total));
+    framesDrawn++;
+
+    // The frame slots that passed while drawing are skipped
+    uint32_t slot = (elapsed / interval) + 1;
+    uint32_t nextSlot = ((micros() - start) / interval) + 1;
+
+    if (nextSlot > slot) {
+      framesSkipped += nextSlot - slot;
+    }
+    nextFrame = nextSlot * interval;
+  }
+
+  drawFrame (from, to, type, 256); // The new page only
+  framesDrawn++;
+  runTime = micros() - start;
+  return true;
+}
+
+//============================================================================================//
+/**
+ * @brief Draws a page into a strip buffer.
+ * 
+ * @param page The page.
+ * @param strip The strip buffer.
+ * @param pageX Screen X-coordinate of the left of the page in this frame.
+ * @param pageY Screen Y-coordinate of the top of the page in this frame.
+ * @param top Screen Y-coordinate of the first row of the strip.
+ */
+void transitionClass:: renderPage (pageClass* page, TFT_eSprite* strip, int16_t pageX, int16_t pageY, int16_t top) {
+  TFT_eSPI* prevTarget = uiParent->setDrawTarget (strip);
+
+  strip->resetViewport();
+
+  if (page->bgColor < 0) {
+    strip->fillSprite (TFT_BLACK);
+  }
+
+  uiParent->setOrigin (-pageX, top - pageY);
+  page->redraw();
+  uiParent->setOrigin (0, 0);
+  uiParent->setDrawTarget (prevTarget);
+}
+
+//============================================================================================//
+/**
+ * @brief Composes and pushes one frame, strip by strip. Strips that show only one of the
+ * pages draw only that page.
+ * 
+ * @param from The old page.
+ * @param to The new page.
+ * @param type One of the CSEUI_TRANSITION_xxx values.
+ * @param progress Position of the frame, from 0 (old page) to 256 (new page).
+ */
+void transitionClass:: drawFrame (pageClass* from, pageClass* to, uint8_t type, uint16_t progress) {
+  int16_t w = screenWidth;
+  int16_t h = screenHeight;
+
+  if (progress >= 256) {
+    type = CSEUI_TRANSITION_NONE;
+  }
+
+  int16_t dx = ((int32_t) w * progress) >> 8;
+  int16_t dy = ((int32_t) h * progress) >> 8;
+  int16_t inX = 0, inY = 0, outX = 0, outY = 0; // Screen positions of the pages
+
+  switch (type) {
+    case CSEUI_TRANSITION_SLIDE_LEFT: inX = w - dx; break;
+    case CSEUI_TRANSITION_SLIDE_RIGHT: inX = dx - w; break;
+    case CSEUI_TRANSITION_SLIDE_UP: inY = h - dy; break;
+    case CSEUI_TRANSITION_SLIDE_DOWN: inY = dy - h; break;
+    case CSEUI_TRANSITION_PUSH_LEFT: inX = w - dx; outX = -dx; break;
+    case CSEUI_TRANSITION_PUSH_RIGHT: inX = dx - w; outX = dx; break;
+    case CSEUI_TRANSITION_PUSH_UP: inY = h - dy; outY = -dy; break;
+    case CSEUI_TRANSITION_PUSH_DOWN: inY = dy - h; outY = dy; break;
+  }
+
+  bool fade = (type == CSEUI_TRANSITION_FADE);
+
+  // Part of the screen covered by the new page
+  int16_t inLeft = (inX > 0) ? inX : 0;
+  int16_t inRight = ((inX + w) < w) ? (inX + w) : w;
+  int16_t inTop = (inY > 0) ? inY : 0;
+  int16_t inBottom = ((inY + h) < h) ? (inY + h) : h;
+
+  TFT_eSPI* lcd = uiParent->lcdParent;
+  bool swap = lcd->getSwapBytes();
+
+  lcd->setSwapBytes (false);  // Sprite buffers are already in the LCD byte order
+
+  for (int16_t top = 0; top < h; top += stripHeight) {
+    int16_t rows = ((h - top) < stripHeight) ? (h - top) : stripHeight;
+    bool showIn = fade || ((inLeft < inRight) && (inTop < (top + rows)) && (inBottom > top));
+    bool showOut = fade || (!((inLeft == 0) && (inRight == w) && (inTop <= top) && (inBottom >= (top + rows))));
+
+    if (showOut) {
+      renderPage (from, stripOut, outX, outY, top);
+    }
+    if (showIn) {
+      renderPage (to, showOut ? stripIn : stripOut, inX, inY, top);
+    }
+
+    uint16_t* out = (uint16_t*) stripOut->getPointer();
+
+    if (showIn && showOut) {
+      uint16_t* in = (uint16_t*) stripIn->getPointer();
+
+      if (fade) {
+        uint8_t alpha = (progress > 255) ? 255 : progress;
+        uint32_t count = (uint32_t) w * rows;
+
+        for (uint32_t i = 0; i < count; i++) {
+          uint16_t a = (in [i] >> 8) | (in [i] << 8); // The buffers hold byte-swapped colors
+          uint16_t b = (out [i] >> 8) | (out [i] << 8);
+          uint16_t c = lcd->alphaBlend (alpha, a, b);
+          out [i] = (c >> 8) | (c << 8);
+        }
+      }
+      else {
+        int16_t first = ((inTop - top) > 0) ? (inTop - top) : 0;
+        int16_t last = ((inBottom - top) < rows) ? (inBottom - top) : rows;
+
+        for (int16_t r = first; r < last; r++) {
+          memcpy (out + (r * w) + inLeft, in + (r * w) + inLeft, (inRight - inLeft) * sizeof (uint16_t));
+        }
+      }
+    }
+
+    lcd->pushImage (0, top, w, rows, out);
+    CSEUI_PROFILE_CALL (w * rows);
+  }
+
+  lcd->setSwapBytes (swap);
+}
+
+//============================================================================================//
+/**
+ * @brief Returns the frame rate reached in the last transition.
+ * 
+ * @return float Frames per second.
+ */
+float transitionClass:: getFps() {
+  if (runTime == 0) return 0;
+  return (framesDrawn * 1000000.0f) / runTime;
+}
+
+//============================================================================================//
+/**
+ * @brief Prints the statistics of the last transition.
+ * 
+ * @param out The output, such as Serial.
+ */
+void transitionClass:: printStats (Print& out) {
+  out.print (F("CSEUI_TRANSITION frames="));
+  out.print (framesDrawn);
+  out.print (F(" skipped="));
+  out.print (framesSkipped);
+  out.print (F(" time="));
+  out.print (runTime / 1000);
+  out.print (F(" fps="));
+  out.println (getFps(), 1);
+}
+
+//============================================================================================//
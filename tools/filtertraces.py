@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+#============================================================================================//
+#
+#  Filename: filtertraces.py
+#  Description: Generates the synthetic touch traces of the FilterTrace example.
+#  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+#  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+#  Version: 0.0.8
+#  License: MIT
+#  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+#  Last Modified: +05:30 07:31:05 AM 21-10-2026, Wednesday
+#
+#============================================================================================//
+#
+#  Prints examples/FilterTrace/traces.h. The traces are made up, not recorded: the jitter,
+#  bounces and dropouts come from a seeded random generator, so the output is the same on
+#  every run. They are written in the touchRecorderClass format, with one record for each
+#  5 ms sample, including the samples that did not change.
+#
+#  Usage:
+#    filtertraces.py > examples/FilterTrace/traces.h
+#
+#  To test the filter with a real panel instead, record the traces with touchRecorderClass
+#  and replace the arrays.
+#
+#============================================================================================//
+
+import random
+
+TRACE_VERSION = 1
+MAX_POINTS = 5
+SAMPLE_PERIOD = 5000  # Microseconds between records
+
+HEADER = """//============================================================================================//
+/*
+  Synthetic touch traces for the FilterTrace example, generated by tools/filtertraces.py.
+  Each trace is in the format written by touchRecorderClass, with one record for every
+  5 ms sample. The point is on a 160 x 60 button at (40, 100).
+
+  traceEdge:  A finger resting on the left edge of the button, with +/-3 px of jitter,
+              a bounce at touch-down, and four single-sample dropouts.
+  traceTap:   A tap in the middle of the button, with a bounce at touch-down and lift.
+  traceDrag:  A finger that lands in the middle of the button and slowly drags off its
+              right edge before lifting.
+*/
+//============================================================================================//
+
+#ifndef FILTER_TRACES_H
+#define FILTER_TRACES_H
+"""
+
+#============================================================================================//
+
+def varint (value):
+  """Encodes the time delta of a record, 7 bits per byte, lowest first."""
+
+  out = []
+
+  while True:
+    b = value & 0x7F
+    value >>= 7
+    if value:
+      out.append (b | 0x80)
+    else:
+      out.append (b)
+      return out
+
+#============================================================================================//
+
+def record (points):
+  """Encodes one sample, given as a list of (x, y, z) points. All points get ID 0."""
+
+  data = varint (SAMPLE_PERIOD) + [len (points)]
+
+  for (x, y, z) in points:
+    data += [0, x & 0xFF, (x >> 8) & 0xFF, y & 0xFF, (y >> 8) & 0xFF, z]
+
+  return data
+
+#============================================================================================//
+
+def trace (samples):
+  data = [ord ('C'), ord ('S'), ord ('T'), ord ('T'), TRACE_VERSION, MAX_POINTS]
+
+  for s in samples:
+    data += record (s)
+
+  return data
+
+#============================================================================================//
+
+def jitter (amount):
+  return random.randint (-amount, amount)
+
+#============================================================================================//
+
+def make_traces():
+  random.seed (29)
+
+  # A finger resting on the left edge of the button (x = 40)
+  edge = [[]] * 3
+  edge += [[(40 + jitter (3), 130 + jitter (2), 30)], [], [(40 + jitter (3), 130, 30)]]  # Bounce at touch-down
+
+  for i in range (120):
+    edge.append ([] if i in (20, 55, 56, 90) else [(40 + jitter (3), 130 + jitter (2), 30 + jitter (5))])
+
+  edge += [[], [(41, 130, 20)], []] + [[]] * 6
+
+  # A tap in the middle of the button
+  tap = [[]] * 3
+  tap += [[(120 + jitter (2), 130 + jitter (2), 30)], [], [(120, 130, 30)], []]
+
+  for i in range (30):
+    tap.append ([(120 + jitter (2), 130 + jitter (2), 30 + jitter (5))])
+
+  tap += [[], [(120, 131, 25)], []] + [[]] * 6
+
+  # A slow drag off the right edge (x = 200)
+  drag = [[]] * 3
+
+  for i in range (90):
+    drag.append ([(120 + i + jitter (4), 130 + jitter (3), 30 + jitter (5))])
+
+  drag += [[]] * 8
+
+  return (("traceEdge", edge), ("traceTap", tap), ("traceDrag", drag))
+
+#============================================================================================//
+
+def main():
+  print (HEADER)
+
+  for name, samples in make_traces():
+    data = trace (samples)
+    print ("const uint8_t %s [] = {  // %d records" % (name, len (samples)))
+
+    for k in range (0, len (data), 16):
+      print ("  " + ", ".join ("0x%02X" % b for b in data [k:k + 16]) + ("," if (k + 16) < len (data) else ""))
+
+    print ("};\n")
+
+  print ("#endif")
+
+#============================================================================================//
+
+if __name__ == "__main__":
+  main()
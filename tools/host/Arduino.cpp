@@ -0,0 +1,50 @@
+//============================================================================================//
+/*
+  Filename: Arduino.cpp
+  Description: Host stand-in for the parts of the Arduino core used by the CSE_UI library
+               and its examples. Only for the host builds in tools/host.
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 06:52:10 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "Arduino.h"
+
+#include <chrono>
+#include <thread>
+
+//============================================================================================//
+
+HardwareSerial Serial;
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+//============================================================================================//
+
+unsigned long micros() {
+  return (unsigned long) std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now() - startTime).count();
+}
+
+//============================================================================================//
+
+unsigned long millis() {
+  return micros() / 1000;
+}
+
+//============================================================================================//
+
+void delay (unsigned long ms) {
+  std::this_thread::sleep_for (std::chrono::milliseconds (ms));
+}
+
+//============================================================================================//
+
+void yield() {
+  std::this_thread::yield();
+}
+
+//============================================================================================//
@@ -0,0 +1,153 @@
+//============================================================================================//
+/*
+  Filename: Arduino.h
+  Description: Host stand-in for the parts of the Arduino core used by the CSE_UI library
+               and its examples. Only for the host builds in tools/host.
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 06:52:10 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#ifndef CSEUI_HOST_ARDUINO_H
+#define CSEUI_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <string>
+
+//============================================================================================//
+
+#define F(x)                      x
+#define PROGMEM
+#define pgm_read_byte(p)          (*(const uint8_t*) (p))
+#define pgm_read_word(p)          (*(const uint16_t*) (p))
+
+#define DEC                       10
+#define HEX                       16
+
+typedef bool boolean;
+
+unsigned long millis();
+unsigned long micros();
+void delay (unsigned long ms);
+void yield();
+
+//============================================================================================//
+/**
+ * @brief The Arduino String, on top of std::string.
+ *
+ */
+class String {
+  public:
+    std::string s;
+
+    String() {}
+    String (const char* c) : s (c ? c : "") {}
+    String (const String& o) : s (o.s) {}
+    String (String&& o) : s (std::move (o.s)) {}
+    explicit String (char c) : s (1, c) {}
+    explicit String (int v) : s (std::to_string (v)) {}
+    explicit String (unsigned int v) : s (std::to_string (v)) {}
+    explicit String (long v) : s (std::to_string (v)) {}
+    explicit String (unsigned long v) : s (std::to_string (v)) {}
+
+    String& operator= (const String& o) { s = o.s; return *this; }
+    String& operator= (String&& o) { s = std::move (o.s); return *this; }
+    String& operator= (const char* c) { s = c ? c : ""; return *this; }
+    bool operator== (const String& o) const { return s == o.s; }
+    bool operator!= (const String& o) const { return s != o.s; }
+    bool operator== (const char* c) const { return s == (c ? c : ""); }
+    bool operator!= (const char* c) const { return s != (c ? c : ""); }
+    String& operator+= (const String& o) { s += o.s; return *this; }
+    String& operator+= (const char* c) { s += c; return *this; }
+    String& operator+= (char c) { s += c; return *this; }
+    char operator[] (unsigned int i) const { return s [i]; }
+
+    bool concat (const String& o) { s += o.s; return true; }
+    bool concat (const char* c) { s += c; return true; }
+    bool concat (const char* c, unsigned int n) { s.append (c, n); return true; }
+    bool concat (char c) { s += c; return true; }
+    bool concat (int v) { s += std::to_string (v); return true; }
+    bool reserve (unsigned int n) { s.reserve (n); return true; }
+    unsigned int length() const { return s.size(); }
+    const char* c_str() const { return s.c_str(); }
+    char charAt (unsigned int i) const { return s [i]; }
+    String substring (unsigned int from) const { return String (s.substr (from).c_str()); }
+    String substring (unsigned int from, unsigned int to) const { return String (s.substr (from, to - from).c_str()); }
+    int indexOf (char c, unsigned int from = 0) const { size_t p = s.find (c, from); return (p == std::string::npos) ? -1 : (int) p; }
+    bool startsWith (const String& o) const { return s.compare (0, o.s.size(), o.s) == 0; }
+    void remove (unsigned int i) { s.erase (i); }
+    void remove (unsigned int i, unsigned int n) { s.erase (i, n); }
+};
+
+inline String operator+ (const String& a, const String& b) { String r (a); r += b; return r; }
+inline String operator+ (const String& a, const char* b) { String r (a); r += b; return r; }
+inline String operator+ (const char* a, const String& b) { String r (a); r += b; return r; }
+
+//============================================================================================//
+/**
+ * @brief The Arduino Print class. Numbers are formatted with snprintf().
+ *
+ */
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write (uint8_t c) = 0;
+    virtual size_t write (const uint8_t* buffer, size_t size) { for (size_t i = 0; i < size; i++) write (buffer [i]); return size; }
+
+    size_t print (const char* str) { size_t n = 0; while (*str) n += write ((uint8_t) *str++); return n; }
+    size_t print (const String& str) { return print (str.c_str()); }
+    size_t print (char c) { return write ((uint8_t) c); }
+    size_t print (int v, int = DEC) { char b [16]; snprintf (b, sizeof (b), "%d", v); return print (b); }
+    size_t print (unsigned int v, int = DEC) { char b [16]; snprintf (b, sizeof (b), "%u", v); return print (b); }
+    size_t print (long v, int = DEC) { char b [24]; snprintf (b, sizeof (b), "%ld", v); return print (b); }
+    size_t print (unsigned long v, int = DEC) { char b [24]; snprintf (b, sizeof (b), "%lu", v); return print (b); }
+    size_t print (double v, int digits = 2) { char b [32]; snprintf (b, sizeof (b), "%.*f", digits, v); return print (b); }
+
+    size_t println() { return write ((uint8_t) '\n'); }
+    size_t println (const char* str) { return print (str) + println(); }
+    size_t println (const String& str) { return print (str) + println(); }
+    size_t println (char c) { return print (c) + println(); }
+    size_t println (int v, int base = DEC) { return print (v, base) + println(); }
+    size_t println (unsigned int v, int base = DEC) { return print (v, base) + println(); }
+    size_t println (long v, int base = DEC) { return print (v, base) + println(); }
+    size_t println (unsigned long v, int base = DEC) { return print (v, base) + println(); }
+    size_t println (double v, int digits = 2) { return print (v, digits) + println(); }
+};
+
+//============================================================================================//
+
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
+
+//============================================================================================//
+/**
+ * @brief Serial port that writes to stdout.
+ *
+ */
+class HardwareSerial : public Stream {
+  public:
+    void begin (unsigned long) {}
+    size_t write (uint8_t c) { putchar (c); return 1; }
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+};
+
+extern HardwareSerial Serial;
+
+//============================================================================================//
+
+#endif // CSEUI_HOST_ARDUINO_H
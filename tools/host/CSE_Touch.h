@@ -0,0 +1,51 @@
+//============================================================================================//
+/*
+  Filename: CSE_Touch.h
+  Description: Host stand-in for the CSE_Touch library. Only the interface is given; the
+               host builds use touchReplayClass instead of a panel. Only for the host builds
+               in tools/host.
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 06:52:10 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#ifndef CSEUI_HOST_CSE_TOUCH_H
+#define CSEUI_HOST_CSE_TOUCH_H
+
+#include <Arduino.h>
+
+//============================================================================================//
+
+class CSE_TouchPoint {
+  public:
+    int16_t x;
+    int16_t y;
+    int16_t z;
+    uint8_t id;
+
+    CSE_TouchPoint() : x (0), y (0), z (0), id (0) {}
+    CSE_TouchPoint (int16_t x, int16_t y, int16_t z) : x (x), y (y), z (z), id (0) {}
+};
+
+//============================================================================================//
+
+class CSE_Touch {
+  public:
+    virtual ~CSE_Touch() {}
+    virtual bool begin() = 0;
+    virtual CSE_TouchPoint getPoint (uint8_t n = 0) = 0;
+    virtual uint8_t getTouches() = 0;
+    virtual bool isTouched (uint8_t id = 0) = 0;
+    virtual bool setRotation (uint8_t rotation) = 0;
+    virtual uint8_t getRotation() = 0;
+    virtual uint16_t getWidth() = 0;
+    virtual uint16_t getHeight() = 0;
+};
+
+//============================================================================================//
+
+#endif // CSEUI_HOST_CSE_TOUCH_H
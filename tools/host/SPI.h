@@ -0,0 +1,13 @@
+//============================================================================================//
+/*
+  Filename: SPI.h
+  Description: Empty host stand-in for the Arduino SPI library. Only for the host builds in
+               tools/host.
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 06:52:10 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
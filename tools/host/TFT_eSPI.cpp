@@ -0,0 +1,326 @@
+//============================================================================================//
+/*
+  Filename: TFT_eSPI.cpp
+  Description: Host stand-in for the TFT_eSPI library. Only for the host builds in
+               tools/host.
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 08:09:14 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#include "TFT_eSPI.h"
+#include <chrono>
+
+//============================================================================================//
+
+TFT_eSPI:: TFT_eSPI (int16_t w, int16_t h) {
+  swapBytes = false;
+  textDatum = TL_DATUM;
+  textFont = 1;
+  textSize = 1;
+  textColor = TFT_WHITE;
+  textBgColor = TFT_BLACK;
+  cursorX = 0;
+  cursorY = 0;
+  windowX = 0;
+  windowY = 0;
+  windowWidth = 1;
+  windowIndex = 0;
+  pixelCount = 0;
+  busSpeed = 0;
+  busDebt = 0;
+  resize (w, h);
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: resize (int32_t w, int32_t h) {
+  frameWidth = w;
+  frameHeight = h;
+  frame.assign ((size_t) w * h, 0);
+  resetViewport();
+}
+
+//============================================================================================//
+/**
+ * @brief Writes one pixel in viewport coordinates, clipped to the viewport and the frame.
+ *
+ */
+void TFT_eSPI:: putPixel (int32_t x, int32_t y, uint16_t color) {
+  x += originX;
+  y += originY;
+
+  if ((x < viewX) || (y < viewY) || (x >= (viewX + viewWidth)) || (y >= (viewY + viewHeight))) return;
+  if ((x < 0) || (y < 0) || (x >= frameWidth) || (y >= frameHeight)) return;
+
+  frame [(size_t) y * frameWidth + x] = color;
+  pixelCount++;
+
+  if (busSpeed > 0) busWait();
+}
+
+//============================================================================================//
+/**
+ * @brief Adds the bus time of one 16-bit pixel, and busy-waits once a chunk of it has
+ * been collected. Sleeping is too coarse for the few microseconds of a small redraw.
+ *
+ */
+void TFT_eSPI:: busWait() {
+  busDebt += (uint32_t) (16000000000ULL / busSpeed);
+
+  if (busDebt < CSEUI_HOST_BUS_CHUNK) return;
+
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::nanoseconds (busDebt);
+
+  while (std::chrono::steady_clock::now() < end);
+  busDebt = 0;
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: fillScreen (uint32_t color) {
+  fillRect (viewDatum ? 0 : viewX, viewDatum ? 0 : viewY, viewWidth, viewHeight, color);
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: fillRect (int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  for (int32_t j = 0; j < h; j++) {
+    for (int32_t i = 0; i < w; i++) {
+      putPixel (x + i, y + j, color);
+    }
+  }
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: drawRect (int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  drawFastHLine (x, y, w, color);
+  drawFastHLine (x, y + h - 1, w, color);
+  drawFastVLine (x, y, h, color);
+  drawFastVLine (x + w - 1, y, h, color);
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: drawPixel (int32_t x, int32_t y, uint32_t color) {
+  putPixel (x, y, color);
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: drawFastHLine (int32_t x, int32_t y, int32_t w, uint32_t color) {
+  fillRect (x, y, w, 1, color);
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: drawFastVLine (int32_t x, int32_t y, int32_t h, uint32_t color) {
+  fillRect (x, y, 1, h, color);
+}
+
+//============================================================================================//
+/**
+ * @brief Filled rectangle with square corners. The corners are not needed to check the
+ * layout.
+ *
+ */
+void TFT_eSPI:: fillSmoothRoundRect (int32_t x, int32_t y, int32_t w, int32_t h, int32_t, uint32_t color, uint32_t) {
+  fillRect (x, y, w, h, color);
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: drawSmoothRoundRect (int32_t x, int32_t y, int32_t, int32_t, int32_t w, int32_t h, uint32_t color, uint32_t, uint8_t) {
+  drawRect (x, y, w, h, color);
+}
+
+//============================================================================================//
+/**
+ * @brief Draws a string as one text-color cell per character, placed by the text datum.
+ *
+ */
+int16_t TFT_eSPI:: drawString (const char* str, int32_t x, int32_t y) {
+  int16_t w = textWidth (str);
+  int16_t h = fontHeight();
+
+  switch (textDatum % 3) {
+    case 1: x -= w / 2; break;
+    case 2: x -= w; break;
+  }
+
+  switch (textDatum / 3) {
+    case 1: y -= h / 2; break;
+    case 2: y -= h; break;
+  }
+
+  fillRect (x, y, w, h, textColor);
+  return w;
+}
+
+//============================================================================================//
+
+size_t TFT_eSPI:: write (uint8_t c) {
+  if (c == '\n') {
+    cursorX = 0;
+    cursorY += fontHeight();
+    return 1;
+  }
+
+  fillRect (cursorX, cursorY, charWidth(), fontHeight(), textColor);
+  cursorX += charWidth();
+  return 1;
+}
+
+//============================================================================================//
+/**
+ * @brief Sets the viewport. With datum true, coordinates are relative to its top-left;
+ * otherwise it only clips.
+ *
+ */
+void TFT_eSPI:: setViewport (int32_t x, int32_t y, int32_t w, int32_t h, bool datum) {
+  viewX = x;
+  viewY = y;
+  viewWidth = w;
+  viewHeight = h;
+  viewDatum = datum;
+  originX = datum ? x : 0;
+  originY = datum ? y : 0;
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: resetViewport() {
+  setViewport (0, 0, frameWidth, frameHeight, true);
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: frameViewport (uint16_t color, int32_t w) {
+  int32_t left = viewDatum ? 0 : viewX;
+  int32_t top = viewDatum ? 0 : viewY;
+
+  for (int32_t i = 0; i < w; i++) {
+    drawRect (left + i, top + i, viewWidth - (2 * i), viewHeight - (2 * i), color);
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Writes a block of pixels. With swapBytes set, the bytes of each pixel are
+ * swapped first, as the real library does.
+ *
+ */
+void TFT_eSPI:: pushImage (int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+  for (int32_t j = 0; j < h; j++) {
+    for (int32_t i = 0; i < w; i++) {
+      uint16_t color = data [(size_t) j * w + i];
+      putPixel (x + i, y + j, swapBytes ? (uint16_t) ((color << 8) | (color >> 8)) : color);
+    }
+  }
+}
+
+//============================================================================================//
+/**
+ * @brief Writes pixels read with readRect() back. The byte order is not swapped, whatever
+ * swapBytes is set to.
+ *
+ */
+void TFT_eSPI:: pushRect (int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+  bool swap = swapBytes;
+
+  swapBytes = false;
+  pushImage (x, y, w, h, data);
+  swapBytes = swap;
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: readRect (int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+  for (int32_t j = 0; j < h; j++) {
+    for (int32_t i = 0; i < w; i++) {
+      int32_t fx = x + i + originX;
+      int32_t fy = y + j + originY;
+      bool inside = (fx >= 0) && (fy >= 0) && (fx < frameWidth) && (fy < frameHeight);
+
+      data [(size_t) j * w + i] = inside ? frame [(size_t) fy * frameWidth + fx] : 0;
+    }
+  }
+}
+
+//============================================================================================//
+
+uint16_t TFT_eSPI:: readPixel (int32_t x, int32_t y) {
+  uint16_t color;
+
+  readRect (x, y, 1, 1, &color);
+  return color;
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: setAddrWindow (int32_t x, int32_t y, int32_t w, int32_t) {
+  windowX = x;
+  windowY = y;
+  windowWidth = (w > 0) ? w : 1;
+  windowIndex = 0;
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: pushColor (uint16_t color) {
+  putPixel (windowX + (windowIndex % windowWidth), windowY + (windowIndex / windowWidth), color);
+  windowIndex++;
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: pushColor (uint16_t color, uint32_t count) {
+  while (count--) {
+    pushColor (color);
+  }
+}
+
+//============================================================================================//
+
+void TFT_eSPI:: pushPixels (const void* data, uint32_t count) {
+  const uint16_t* pixels = (const uint16_t*) data;
+
+  for (uint32_t i = 0; i < count; i++) {
+    pushColor (pixels [i]);
+  }
+}
+
+//============================================================================================//
+
+uint16_t TFT_eSPI:: alphaBlend (uint8_t alpha, uint16_t fgColor, uint16_t bgColor) {
+  uint32_t rb = (((fgColor & 0xF81F) * alpha) + ((bgColor & 0xF81F) * (255 - alpha))) / 255;
+  uint32_t g = (((fgColor & 0x07E0) * alpha) + ((bgColor & 0x07E0) * (255 - alpha))) / 255;
+
+  return (uint16_t) ((rb & 0xF81F) | (g & 0x07E0));
+}
+
+//============================================================================================//
+/**
+ * @brief Moves the sprite contents. The uncovered pixels are cleared to black.
+ *
+ */
+void TFT_eSprite:: scroll (int16_t dx, int16_t dy) {
+  std::vector<uint16_t> old = frame;
+
+  for (int32_t y = 0; y < frameHeight; y++) {
+    for (int32_t x = 0; x < frameWidth; x++) {
+      int32_t sx = x - dx;
+      int32_t sy = y - dy;
+      bool inside = (sx >= 0) && (sy >= 0) && (sx < frameWidth) && (sy < frameHeight);
+
+      frame [(size_t) y * frameWidth + x] = inside ? old [(size_t) sy * frameWidth + sx] : TFT_BLACK;
+    }
+  }
+}
+
+//============================================================================================//
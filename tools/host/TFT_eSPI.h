@@ -0,0 +1,181 @@
+//============================================================================================//
+/*
+  Filename: TFT_eSPI.h
+  Description: Host stand-in for the TFT_eSPI library. Draws into a framebuffer in RAM, so
+               the CSE_UI library and its examples can run on a PC. Only for the host builds
+               in tools/host.
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 08:09:14 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+
+#ifndef CSEUI_HOST_TFT_ESPI_H
+#define CSEUI_HOST_TFT_ESPI_H
+
+#include <Arduino.h>
+#include <vector>
+
+//============================================================================================//
+
+#define TFT_BLACK       0x0000
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_RED         0xF800
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_TRANSPARENT 0x0120
+
+#define TL_DATUM        0
+#define TC_DATUM        1
+#define TR_DATUM        2
+#define ML_DATUM        3
+#define MC_DATUM        4
+#define MR_DATUM        5
+#define BL_DATUM        6
+#define BC_DATUM        7
+#define BR_DATUM        8
+
+#define TFT_WIDTH       240
+#define TFT_HEIGHT      320
+
+#define CSEUI_HOST_BUS_CHUNK  10000 // Nanoseconds of bus time to collect before waiting
+
+//============================================================================================//
+/**
+ * @brief A TFT_eSPI with a framebuffer instead of a panel. Text is drawn as one filled
+ * 6 x 8 cell per character in the text color, which is enough to see what was drawn and
+ * where. Font 2 has 8 x 8 cells instead, so it differs from font 1 in width only, and the
+ * text size scales the cells. Every pixel written is counted in pixelCount.
+ *
+ * With setBusSpeed(), each pixel written also takes the time a 16-bit transfer over a bus
+ * of that speed would, so latency and frame times come out close to a real panel. The
+ * delay is paid in chunks of CSEUI_HOST_BUS_CHUNK nanoseconds. Sprites have no bus.
+ *
+ */
+class TFT_eSPI : public Print {
+  protected:
+    std::vector<uint16_t> frame;
+    int32_t frameWidth;
+    int32_t frameHeight;
+    int32_t viewX;  // Viewport; drawing is clipped to it
+    int32_t viewY;
+    int32_t viewWidth;
+    int32_t viewHeight;
+    int32_t originX;  // Added to the coordinates; the viewport position if datum is true
+    int32_t originY;
+    bool viewDatum;
+    bool swapBytes;
+    uint8_t textDatum;
+    uint8_t textFont;
+    uint8_t textSize;
+    uint16_t textColor;
+    uint16_t textBgColor;
+    int32_t cursorX;
+    int32_t cursorY;
+    int32_t windowX;  // Address window of setAddrWindow()
+    int32_t windowY;
+    int32_t windowWidth;
+    uint32_t windowIndex;
+    uint32_t busSpeed;  // Simulated bus clock in Hz, or 0 for none
+    uint32_t busDebt; // Nanoseconds of bus time not waited for yet
+
+    void putPixel (int32_t x, int32_t y, uint16_t color);
+    void busWait();
+    void resize (int32_t w, int32_t h);
+
+  public:
+    uint64_t pixelCount;
+
+    TFT_eSPI (int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+    virtual ~TFT_eSPI() {}
+
+    void begin() {}
+    void setBusSpeed (uint32_t hz) { busSpeed = hz; busDebt = 0; }
+    void setRotation (uint8_t) {}
+    int16_t width() { return frameWidth; }
+    int16_t height() { return frameHeight; }
+
+    void fillScreen (uint32_t color);
+    void fillRect (int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRect (int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawPixel (int32_t x, int32_t y, uint32_t color);
+    void drawFastHLine (int32_t x, int32_t y, int32_t w, uint32_t color);
+    void drawFastVLine (int32_t x, int32_t y, int32_t h, uint32_t color);
+    void fillSmoothRoundRect (int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color, uint32_t bgColor = 0x00FFFFFF);
+    void drawSmoothRoundRect (int32_t x, int32_t y, int32_t r, int32_t ir, int32_t w, int32_t h, uint32_t color, uint32_t bgColor = 0x00FFFFFF, uint8_t quadrants = 0xF);
+
+    void setTextFont (uint8_t font) { textFont = font; }
+    void setTextSize (uint8_t size) { textSize = (size > 0) ? size : 1; }
+    void setTextWrap (bool, bool = false) {}
+    void setTextColor (uint16_t color) { textColor = color; }
+    void setTextColor (uint16_t color, uint16_t bgColor, bool = false) { textColor = color; textBgColor = bgColor; }
+    void setTextDatum (uint8_t datum) { textDatum = datum; }
+    uint8_t getTextDatum() { return textDatum; }
+    void setCursor (int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+    void loadFont (const uint8_t*) {}
+    int16_t charWidth() { return ((textFont == 2) ? 8 : 6) * textSize; }
+    int16_t fontHeight() { return 8 * textSize; }
+    int16_t textWidth (const char* str) { return strlen (str) * charWidth(); }
+    int16_t textWidth (const String& str) { return str.length() * charWidth(); }
+    int16_t drawString (const char* str, int32_t x, int32_t y);
+    int16_t drawString (const String& str, int32_t x, int32_t y) { return drawString (str.c_str(), x, y); }
+    size_t write (uint8_t c);
+
+    void setViewport (int32_t x, int32_t y, int32_t w, int32_t h, bool datum = true);
+    void resetViewport();
+    void frameViewport (uint16_t color, int32_t w);
+    int32_t getViewportX() { return viewX; }
+    int32_t getViewportY() { return viewY; }
+    int32_t getViewportWidth() { return viewWidth; }
+    int32_t getViewportHeight() { return viewHeight; }
+    bool getViewportDatum() { return viewDatum; }
+
+    void pushImage (int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+    void pushRect (int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+    void readRect (int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+    uint16_t readPixel (int32_t x, int32_t y);
+    bool getSwapBytes() { return swapBytes; }
+    void setSwapBytes (bool swap) { swapBytes = swap; }
+
+    void startWrite() {}
+    void endWrite() {}
+    void setAddrWindow (int32_t x, int32_t y, int32_t w, int32_t h);
+    void pushColor (uint16_t color);
+    void pushColor (uint16_t color, uint32_t count);
+    void pushBlock (uint16_t color, uint32_t count) { pushColor (color, count); }
+    void pushPixels (const void* data, uint32_t count);
+    bool dmaBusy() { return false; }
+    void dmaWait() {}
+
+    uint16_t alphaBlend (uint8_t alpha, uint16_t fgColor, uint16_t bgColor);
+    uint16_t color565 (uint8_t r, uint8_t g, uint8_t b) { return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3); }
+    uint16_t* getFrame() { return frame.data(); }
+};
+
+//============================================================================================//
+
+class TFT_eSprite : public TFT_eSPI {
+  private:
+    bool spriteCreated;
+
+  public:
+    TFT_eSprite (TFT_eSPI*) : TFT_eSPI (1, 1), spriteCreated (false) {}
+
+    void* createSprite (int16_t w, int16_t h, uint8_t = 1) { resize (w, h); spriteCreated = true; return frame.data(); }
+    void deleteSprite() { spriteCreated = false; }
+    bool created() { return spriteCreated; }
+    void setColorDepth (int8_t) {}
+    void setPsram (bool) {}
+    void fillSprite (uint32_t color) { fillScreen (color); }
+    void scroll (int16_t dx, int16_t dy = 0);
+    void pushSprite (int32_t, int32_t) {}
+    void* getPointer() { return frame.data(); }
+};
+
+//============================================================================================//
+
+#endif // CSEUI_HOST_TFT_ESPI_H
@@ -0,0 +1,49 @@
+//============================================================================================//
+/*
+  Filename: TaskStressHost.cpp
+  Description: Runs the TaskStress example on a PC, with the input and render tasks of
+               CSE_UI on two std::threads.
+  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+  Version: 0.0.8
+  License: MIT
+  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+  Last Modified: +05:30 07:52:36 AM 21-10-2026, Wednesday
+ */
+//============================================================================================//
+/*
+  The sketch is built unchanged against the stand-ins in this folder: the LCD is a
+  framebuffer, there is no touch panel, and the touches come from the replay trace the
+  sketch builds. Since ARDUINO is not defined, CSE_UI.h selects CSEUI_HOST_BUILD and
+  beginTasks() starts std::threads.
+
+  Build and run from the root of the library:
+
+    g++ -std=gnu++11 -O1 -pthread -Itools/host -Isrc tools/host/TaskStressHost.cpp \
+        tools/host/Arduino.cpp tools/host/TFT_eSPI.cpp src/CSE_UI*.cpp -o TaskStressHost
+    ./TaskStressHost
+
+  The LCD is given a simulated 40 MHz bus, so the render task takes about as long to
+  draw as on a real panel and the two threads overlap the way they do on the board.
+
+  Add -fsanitize=thread to have data races between the threads reported as well. The
+  exit code is 0 if the test passed.
+*/
+//============================================================================================//
+
+#include "../../examples/TaskStress/TaskStress.ino"
+
+//============================================================================================//
+
+int main() {
+  LCD.setBusSpeed (40000000); // Every pixel costs what it would on a 40 MHz SPI bus
+  setup();
+
+  while (!testDone) {
+    loop();
+  }
+
+  return testPassed ? 0 : 1;
+}
+
+//============================================================================================//
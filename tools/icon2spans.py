@@ -0,0 +1,280 @@
+#!/usr/bin/env python3
+#============================================================================================//
+#
+#  Filename: icon2spans.py
+#  Description: Converts icons to the span-encoded format of the CSE_UI Arduino library.
+#  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+#  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+#  Version: 0.0.8
+#  License: MIT
+#  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+#  Last Modified: +05:30 01:12:40 PM 20-10-2026, Tuesday
+#
+#============================================================================================//
+#
+#  Reads icons from C arrays in the vertical-byte format used by iconClass::initialize(),
+#  or from a BDF font, and prints C arrays for iconClass::initializeSpans(). With --alpha,
+#  prints 4-bit alpha icons for iconClass::initializeAlpha() instead.
+#
+#  Usage:
+#    icon2spans.py array icons.h --height 32 [--name NAME ...] [--alpha N]
+#    icon2spans.py bdf font.bdf [--char 0xF015 ...] [--alpha N]
+#
+#  The span format has an 8-byte header:
+#    0xC5, cell width, cell height, glyph X, glyph Y, glyph width, glyph height, 0
+#  followed, for each row of the glyph bounds, by the number of spans in the row and a
+#  (start, length) byte pair for each span. Starts are from the left of the glyph bounds.
+#
+#  The alpha format has the same header with the marker 0xA4, followed by the coverage of
+#  each pixel of the glyph bounds, 0 to 15, two pixels per byte with the left one in the
+#  high nibble. Each row starts on a new byte. The coverage is found by drawing the icon
+#  N times larger than it is shown and counting the set pixels of each N x N block, so
+#  convert a BDF font rendered at N times the size you need.
+#
+#============================================================================================//
+
+import argparse
+import re
+import sys
+
+SPAN_MARKER = 0xC5
+ALPHA_MARKER = 0xA4
+
+#============================================================================================//
+
+def spans_from_rows (rows, width, height):
+  """Encodes a bitmap given as a list of rows of 0/1 values."""
+
+  set_rows = [y for y in range (height) if any (rows [y])]
+  set_cols = [x for x in range (width) if any (rows [y][x] for y in range (height))]
+
+  if not set_rows: # Empty glyph
+    return bytes ([SPAN_MARKER, width, height, 0, 0, 0, 0, 0])
+
+  gx, gy = set_cols [0], set_rows [0]
+  gw, gh = set_cols [-1] - gx + 1, set_rows [-1] - gy + 1
+  out = [SPAN_MARKER, width, height, gx, gy, gw, gh, 0]
+
+  for y in range (gy, gy + gh):
+    spans = []
+    x = gx
+
+    while x < gx + gw:
+      if rows [y][x]:
+        start = x
+        while (x < gx + gw) and rows [y][x] and (x - start < 255):
+          x += 1
+        spans.append ((start - gx, x - start))
+      else:
+        x += 1
+
+    if len (spans) > 255:
+      sys.exit ("Too many spans in a row")
+
+    out.append (len (spans))
+    for start, length in spans:
+      out += [start, length]
+
+  if max (width, height) > 255:
+    sys.exit ("Icons must be at most 255 x 255 pixels")
+
+  return bytes (out)
+
+#============================================================================================//
+
+def alpha_from_rows (rows, width, height, scale):
+  """Downscales a bitmap by the scale and encodes the coverage of each pixel."""
+
+  out_w, out_h = (width + scale - 1) // scale, (height + scale - 1) // scale
+  levels = [[0] * out_w for _ in range (out_h)]
+
+  for y in range (out_h):
+    for x in range (out_w):
+      count = 0
+      for sy in range (y * scale, min ((y + 1) * scale, height)):
+        for sx in range (x * scale, min ((x + 1) * scale, width)):
+          count += rows [sy][sx]
+      levels [y][x] = ((count * 15) + ((scale * scale) // 2)) // (scale * scale)
+
+  if max (out_w, out_h) > 255:
+    sys.exit ("Icons must be at most 255 x 255 pixels")
+
+  set_rows = [y for y in range (out_h) if any (levels [y])]
+  set_cols = [x for x in range (out_w) if any (levels [y][x] for y in range (out_h))]
+
+  if not set_rows: # Empty glyph
+    return bytes ([ALPHA_MARKER, out_w, out_h, 0, 0, 0, 0, 0])
+
+  gx, gy = set_cols [0], set_rows [0]
+  gw, gh = set_cols [-1] - gx + 1, set_rows [-1] - gy + 1
+  out = [ALPHA_MARKER, out_w, out_h, gx, gy, gw, gh, 0]
+
+  for y in range (gy, gy + gh):
+    row = levels [y][gx:gx + gw] + [0]  # Padding for odd widths
+    for x in range (0, gw, 2):
+      out.append ((row [x] << 4) | row [x + 1])
+
+  return bytes (out)
+
+#============================================================================================//
+
+def rows_from_vertical_bytes (data, width, height):
+  """Decodes the iconClass array format: the column count, then the vertical bytes of
+  each column, least significant bit on top."""
+
+  columns = data [0]
+  byte_count = (height + 7) // 8
+  rows = [[0] * width for _ in range (height)]
+
+  for i in range (min (columns, width)):
+    for j in range (byte_count):
+      index = 1 + j + (i * byte_count)
+      if index >= len (data):
+        break
+      for m in range (8):
+        y = (8 * j) + m
+        if (y < height) and ((data [index] >> m) & 1):
+          rows [y][i] = 1
+
+  return rows
+
+#============================================================================================//
+
+def read_arrays (path):
+  """Returns (name, bytes) for every byte array initialiser in a C file."""
+
+  text = open (path, encoding = "utf-8", errors = "replace").read()
+  text = re.sub (r"//.*?$|/\*.*?\*/", "", text, flags = re.S | re.M)
+  pattern = re.compile (r"(\w+)\s*\[[^\]]*\]\s*(?:PROGMEM\s*)?=\s*\{([^}]*)\}", re.S)
+
+  for match in pattern.finditer (text):
+    values = [int (v, 0) & 0xFF for v in re.findall (r"0[xX][0-9a-fA-F]+|\d+", match.group (2))]
+    if values:
+      yield match.group (1), values
+
+#============================================================================================//
+
+def read_bdf (path):
+  """Returns (name, encoding, rows, width, height) for every glyph of a BDF font. Glyphs are
+  placed in the font bounding box, so all of them share the same cell."""
+
+  lines = open (path, encoding = "utf-8", errors = "replace").read().splitlines()
+  font_w, font_h, font_x, font_y = 0, 0, 0, 0
+  i = 0
+
+  while i < len (lines):
+    words = lines [i].split()
+
+    if words and words [0] == "FONTBOUNDINGBOX":
+      font_w, font_h, font_x, font_y = [int (v) for v in words [1:5]]
+
+    elif words and words [0] == "STARTCHAR":
+      name = words [1] if len (words) > 1 else "glyph"
+      encoding, bbx, bitmap = -1, (0, 0, 0, 0), []
+      i += 1
+
+      while (i < len (lines)) and (not lines [i].startswith ("ENDCHAR")):
+        words = lines [i].split()
+        if words and words [0] == "ENCODING":
+          encoding = int (words [1])
+        elif words and words [0] == "BBX":
+          bbx = tuple (int (v) for v in words [1:5])
+        elif words and words [0] == "BITMAP":
+          i += 1
+          while not lines [i].startswith ("ENDCHAR"):
+            bitmap.append (lines [i].strip())
+            i += 1
+          break
+        i += 1
+
+      w, h, ox, oy = bbx
+      rows = [[0] * font_w for _ in range (font_h)]
+      top = (font_h + font_y) - (h + oy)  # Rows from the top of the cell
+
+      for r, hexrow in enumerate (bitmap):
+        value = int (hexrow, 16) if hexrow else 0
+        bits = len (hexrow) * 4
+        for c in range (w):
+          x, y = (ox - font_x) + c, top + r
+          if (0 <= x < font_w) and (0 <= y < font_h) and ((value >> (bits - 1 - c)) & 1):
+            rows [y][x] = 1
+
+      yield name, encoding, rows, font_w, font_h
+
+    i += 1
+
+#============================================================================================//
+
+def c_identifier (name):
+  name = re.sub (r"\W", "_", name)
+  return name if not name [0].isdigit() else "_" + name
+
+#============================================================================================//
+
+def print_array (name, data, source_size, suffix = "spans"):
+  print ("// %s: %d bytes (%d bytes before)" % (name, len (data), source_size))
+  print ("const uint8_t %s_%s[] PROGMEM = {" % (name, suffix))
+
+  for k in range (0, len (data), 16):
+    print ("  " + ", ".join ("0x%02X" % b for b in data [k:k + 16]) + ",")
+
+  print ("};")
+  print()
+
+#============================================================================================//
+
+def main():
+  parser = argparse.ArgumentParser (description = "Converts icons to the CSE_UI span format.")
+  sub = parser.add_subparsers (dest = "input", required = True)
+
+  p = sub.add_parser ("array", help = "C arrays in the iconClass vertical-byte format")
+  p.add_argument ("file")
+  p.add_argument ("--height", type = int, required = True, help = "Cell height in pixels")
+  p.add_argument ("--width", type = int, help = "Cell width; the column count of each icon by default")
+  p.add_argument ("--name", action = "append", help = "Convert only this array; can be repeated")
+
+  p = sub.add_parser ("bdf", help = "A BDF bitmap font")
+  p.add_argument ("file")
+  p.add_argument ("--char", action = "append", help = "Convert only this code point, such as 0xF015; can be repeated")
+
+  for p in sub.choices.values():
+    p.add_argument ("--alpha", type = int, metavar = "N", help = "Print 4-bit alpha icons, N times smaller than the input")
+
+  args = parser.parse_args()
+  total_before, total_after = 0, 0
+  suffix = "alpha" if args.alpha else "spans"
+
+  def encode (rows, width, height):
+    if args.alpha:
+      return alpha_from_rows (rows, width, height, args.alpha)
+    return spans_from_rows (rows, width, height)
+
+  print ("// Generated by tools/icon2spans.py for iconClass::%s()" % ("initializeAlpha" if args.alpha else "initializeSpans"))
+  print()
+
+  if args.input == "array":
+    for name, data in read_arrays (args.file):
+      if args.name and (name not in args.name):
+        continue
+      width = args.width if args.width else data [0]
+      spans = encode (rows_from_vertical_bytes (data, width, args.height), width, args.height)
+      print_array (c_identifier (name), spans, len (data), suffix)
+      total_before += len (data)
+      total_after += len (spans)
+  else:
+    wanted = set (int (c, 0) for c in args.char) if args.char else None
+
+    for name, encoding, rows, width, height in read_bdf (args.file):
+      if (wanted is not None) and (encoding not in wanted):
+        continue
+      spans = encode (rows, width, height)
+      print_array (c_identifier ("%s_%04X" % (name, encoding)), spans, width * ((height + 7) // 8) + 1, suffix)
+      total_before += width * ((height + 7) // 8) + 1
+      total_after += len (spans)
+
+  print ("// Total: %d bytes (%d bytes before)" % (total_after, total_before))
+
+#============================================================================================//
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,315 @@
+#!/usr/bin/env python3
+#============================================================================================//
+#
+#  Filename: screen2bin.py
+#  Description: Compiles screen descriptions to the screen file format of the CSE_UI Arduino
+#               library.
+#  Author: Vishnu Mohanan (@vishnumaiea, @vizmohanan)
+#  Maintainer: CIRCUITSTATE Electronics (@circuitstate)
+#  Version: 0.0.8
+#  License: MIT
+#  Source: https://github.com/CIRCUITSTATE/CSE_CST328
+#  Last Modified: +05:30 04:21:13 AM 21-10-2026, Wednesday
+#
+#============================================================================================//
+#
+#  Reads a text description of styles, pages and widgets, and writes a screen file for
+#  screenLoaderClass. Optionally writes a C header with the widget IDs, and the screen file
+#  as a C array for memorySourceClass.
+#
+#  Usage:
+#    screen2bin.py screens.txt -o screens.csu [--ids screen_ids.h] [--array screens.h]
+#
+#  Description format, one statement per line, # starts a comment:
+#    style NAME fg=COLOR bg=COLOR [border=COLOR] [focusfg=COLOR] [focusbg=COLOR]
+#    page NUMBER [bg=COLOR]
+#    button NAME x= y= w= h= [style=NAME] [text="..."] [border] [nofill] [hidden] [disabled]
+#    list NAME x= y= w= h= [style=NAME] [visible=N] items="One","Two",...
+#    textarea NAME x= y= w= h= [style=NAME] [text="..."] [hidden]
+#    string NAME x= y= [style=NAME] [text="..."] [hidden]
+#    pagination NAME x= y= w= h= [style=NAME] max=N [border] [hidden]
+#
+#  Widgets belong to the last page statement. Colors are numbers such as 0xF800 or TFT_xxx
+#  names. For lists, w and h are the size of a row. The border color of a list style is
+#  the focus foreground color. Widget names become IDs, numbered from 1 in file order.
+#  Widgets without a style get the default style of the loader: white on black, with a
+#  white border or focus foreground and a black focus background.
+#
+#  The screen file is little-endian:
+#    Header (8 bytes): "CSU", version 1, page count, style count, string count (16-bit)
+#    Page directory (12 bytes per page): page number, flags (bit 0: fill), background color,
+#      widget count, 0, offset of the first widget record (32-bit)
+#    Styles (8 bytes each): fg, bg, border or focus fg, focus bg
+#    String offsets (32-bit each), then strings as a 16-bit length and UTF-8 bytes
+#    Widget records (18 bytes each): type, flags, ID, x, y, w, h, style (0xFF for the
+#      default), 0, text ID (0xFFFF for none), extra value count, followed by the 16-bit
+#      extra values
+#
+#============================================================================================//
+
+import argparse
+import shlex
+import struct
+import sys
+
+VERSION = 1
+
+WIDGET_TYPES = {"button": 1, "list": 2, "textarea": 3, "string": 4, "pagination": 5}
+
+FLAGS = {"hidden": 0x01, "border": 0x02, "nofill": 0x04, "disabled": 0x08}
+
+PAGE_FILL = 0x01
+NO_TEXT = 0xFFFF
+DEFAULT_STYLE = 0xFF  # Not a valid style index, so the loader uses its default style
+
+COLORS = {
+  "TFT_BLACK": 0x0000, "TFT_NAVY": 0x000F, "TFT_DARKGREEN": 0x03E0, "TFT_DARKCYAN": 0x03EF,
+  "TFT_MAROON": 0x7800, "TFT_PURPLE": 0x780F, "TFT_OLIVE": 0x7BE0, "TFT_LIGHTGREY": 0xD69A,
+  "TFT_DARKGREY": 0x7BEF, "TFT_BLUE": 0x001F, "TFT_GREEN": 0x07E0, "TFT_CYAN": 0x07FF,
+  "TFT_RED": 0xF800, "TFT_MAGENTA": 0xF81F, "TFT_YELLOW": 0xFFE0, "TFT_WHITE": 0xFFFF,
+  "TFT_ORANGE": 0xFDA0, "TFT_GREENYELLOW": 0xB7E0, "TFT_PINK": 0xFE19,
+}
+
+#============================================================================================//
+
+class ScreenError (Exception):
+  pass
+
+#============================================================================================//
+
+def parse_color (value):
+  if value in COLORS:
+    return COLORS [value]
+  try:
+    color = int (value, 0)
+  except ValueError:
+    raise ScreenError ("Unknown color '%s'" % value)
+  if not (0 <= color <= 0xFFFF):
+    raise ScreenError ("Color out of range '%s'" % value)
+  return color
+
+#============================================================================================//
+
+def parse_int (value, name):
+  try:
+    number = int (value, 0)
+  except ValueError:
+    raise ScreenError ("'%s' must be a number" % name)
+  if not (-32768 <= number <= 65535):
+    raise ScreenError ("'%s' out of range" % name)
+  return number
+
+#============================================================================================//
+
+def split_items (line):
+  """Reads the items="One","Two" option from the raw statement. shlex joins the quoted
+  texts into one word, so commas inside the quotes could not be told apart."""
+
+  start = line.index ("items=") + 6
+  items, current, quoted = [], "", False
+
+  for c in line [start:]:
+    if c == '"':
+      quoted = not quoted
+    elif (c == ",") and (not quoted):
+      items.append (current)
+      current = ""
+    elif (c in " \t#") and (not quoted):
+      break
+    else:
+      current += c
+
+  items.append (current)
+  return items
+
+#============================================================================================//
+
+class Screen:
+  def __init__ (self):
+    self.styles = {}  # name -> (index, colors)
+    self.pages = []   # [number, bg, widgets]
+    self.strings = [] # texts, indexed by text ID
+    self.string_ids = {}
+    self.widget_ids = {}  # name -> ID
+
+  def text_id (self, text):
+    if text is None:
+      return NO_TEXT
+    if text not in self.string_ids:
+      self.string_ids [text] = len (self.strings)
+      self.strings.append (text)
+    return self.string_ids [text]
+
+  #------------------------------------------------------------------------//
+
+  def parse (self, lines):
+    for number, line in enumerate (lines, 1):
+      try:
+        self.parse_line (line)
+      except ScreenError as e:
+        sys.exit ("Line %d: %s" % (number, e))
+      except ValueError as e: # Unbalanced quotes
+        sys.exit ("Line %d: %s" % (number, e))
+
+  #------------------------------------------------------------------------//
+
+  def parse_line (self, line):
+    raw = line
+    words = shlex.split (line, comments = True)
+
+    if not words:
+      return
+
+    keyword, args = words [0], words [1:]
+    options, switches = {}, set()
+
+    for arg in args [1:]:
+      if "=" in arg:
+        key, value = arg.split ("=", 1)
+        options [key] = value
+      else:
+        switches.add (arg)
+
+    if keyword == "style":
+      if not args:
+        raise ScreenError ("A style needs a name")
+      fg = parse_color (options.get ("fg", "TFT_WHITE"))
+      bg = parse_color (options.get ("bg", "TFT_BLACK"))
+      border = parse_color (options.get ("border", options.get ("focusfg", "TFT_WHITE")))
+      focus_bg = parse_color (options.get ("focusbg", "TFT_BLACK"))
+      if len (self.styles) >= 255:
+        raise ScreenError ("Too many styles")
+      self.styles [args [0]] = (len (self.styles), (fg, bg, border, focus_bg))
+
+    elif keyword == "page":
+      if not args:
+        raise ScreenError ("A page needs a number")
+      page = parse_int (args [0], "page")
+      if not (0 <= page <= 255):
+        raise ScreenError ("Page numbers are 0 to 255")
+      if any (p [0] == page for p in self.pages):
+        raise ScreenError ("Page %d is defined twice" % page)
+      bg = parse_color (options ["bg"]) if "bg" in options else None
+      self.pages.append ([page, bg, []])
+
+    elif keyword in WIDGET_TYPES:
+      if not self.pages:
+        raise ScreenError ("Widgets must follow a page statement")
+      if not args:
+        raise ScreenError ("A widget needs a name")
+
+      name = args [0]
+      if name in self.widget_ids:
+        raise ScreenError ("Widget '%s' is defined twice" % name)
+      self.widget_ids [name] = len (self.widget_ids) + 1
+
+      flags = 0
+      for switch in switches:
+        if switch not in FLAGS:
+          raise ScreenError ("Unknown option '%s'" % switch)
+        flags |= FLAGS [switch]
+
+      style = options.get ("style")
+      if (style is not None) and (style not in self.styles):
+        raise ScreenError ("Unknown style '%s'" % style)
+      style_index = self.styles [style][0] if style else DEFAULT_STYLE
+
+      geometry = [parse_int (options.get (k, "0"), k) for k in ("x", "y", "w", "h")]
+      extras = []
+
+      if keyword == "list":
+        if "items" not in options:
+          raise ScreenError ("A list needs items")
+        items = split_items (raw)
+        extras = [parse_int (options.get ("visible", str (len (items))), "visible")]
+        extras += [self.text_id (item) for item in items]
+      elif keyword == "pagination":
+        extras = [parse_int (options.get ("max", "1"), "max")]
+
+      text = self.text_id (options.get ("text")) if "text" in options else NO_TEXT
+      self.pages [-1][2].append ((WIDGET_TYPES [keyword], flags, self.widget_ids [name], geometry, style_index, text, extras))
+
+    else:
+      raise ScreenError ("Unknown statement '%s'" % keyword)
+
+  #------------------------------------------------------------------------//
+
+  def build (self):
+    if len (self.pages) > 255:
+      sys.exit ("Too many pages")
+    if len (self.strings) > 0xFFFE:
+      sys.exit ("Too many texts")
+
+    styles = sorted (self.styles.values())
+    header_size = 8 + (len (self.pages) * 12) + (len (styles) * 8) + (len (self.strings) * 4)
+
+    string_data = b""
+    string_offsets = []
+    for text in self.strings:
+      encoded = text.encode ("utf-8")
+      if len (encoded) > 0xFFFF:
+        sys.exit ("Text too long: %s..." % text [:20])
+      string_offsets.append (header_size + len (string_data))
+      string_data += struct.pack ("<H", len (encoded)) + encoded
+
+    widget_data = b""
+    directory = b""
+    base = header_size + len (string_data)
+
+    for page, bg, widgets in self.pages:
+      if len (widgets) > 0xFFFF:
+        sys.exit ("Too many widgets on page %d" % page)
+      directory += struct.pack ("<BBHHHI", page, PAGE_FILL if bg is not None else 0, bg or 0, len (widgets), 0, base + len (widget_data))
+      for kind, flags, wid, (x, y, w, h), style, text, extras in widgets:
+        widget_data += struct.pack ("<BBHhhhhBBHH", kind, flags, wid, x, y, w, h, style, 0, text, len (extras))
+        widget_data += b"".join (struct.pack ("<H", e & 0xFFFF) for e in extras)
+
+    out = b"CSU" + struct.pack ("<BBBH", VERSION, len (self.pages), len (styles), len (self.strings))
+    out += directory
+    out += b"".join (struct.pack ("<HHHH", *colors) for _, colors in styles)
+    out += b"".join (struct.pack ("<I", o) for o in string_offsets)
+    out += string_data + widget_data
+    return out
+
+#============================================================================================//
+
+def c_identifier (name):
+  return "".join (c if c.isalnum() else "_" for c in name).upper()
+
+#============================================================================================//
+
+def main():
+  parser = argparse.ArgumentParser (description = "Compiles CSE_UI screen descriptions.")
+  parser.add_argument ("file")
+  parser.add_argument ("-o", "--output", help = "Screen file to write")
+  parser.add_argument ("--ids", help = "C header to write the widget IDs to")
+  parser.add_argument ("--array", help = "C header to write the screen file to, as a PROGMEM array")
+  args = parser.parse_args()
+
+  screen = Screen()
+  screen.parse (open (args.file, encoding = "utf-8").read().splitlines())
+  data = screen.build()
+
+  if args.output:
+    open (args.output, "wb").write (data)
+
+  if args.ids:
+    with open (args.ids, "w") as f:
+      f.write ("// Generated by tools/screen2bin.py from %s\n\n" % args.file)
+      for name, wid in screen.widget_ids.items():
+        f.write ("#define   SCREEN_ID_%s   %d\n" % (c_identifier (name), wid))
+
+  if args.array:
+    with open (args.array, "w") as f:
+      f.write ("// Generated by tools/screen2bin.py from %s\n\n" % args.file)
+      f.write ("const uint8_t screen_data[] PROGMEM = {\n")
+      for k in range (0, len (data), 16):
+        f.write ("  " + ", ".join ("0x%02X" % b for b in data [k:k + 16]) + ",\n")
+      f.write ("};\n")
+
+  print ("%d pages, %d widgets, %d texts, %d bytes" % (len (screen.pages), len (screen.widget_ids), len (screen.strings), len (data)))
+
+#============================================================================================//
+
+if __name__ == "__main__":
+  main()